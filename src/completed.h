@@ -1,918 +0,0 @@
-// array size is 14632
-uint8_t completed[]  = {
-  0x00, 0x00, 0x03, 0x03, 0x05, 0x05, 0x0c, 0x06, 0x01, 0x17, 0x0d, 0x0b, 0x24, 0x22, 0x0f, 0x02, 
-  0x0c, 0x01, 0xea, 0xfd, 0xec, 0xea, 0x02, 0xf9, 0xf2, 0xf9, 0xf7, 0xde, 0xf0, 0x02, 0xfa, 0xeb, 
-  0xf2, 0x16, 0x09, 0xf1, 0xfe, 0x19, 0x19, 0x01, 0x0c, 0x1d, 0x17, 0x1e, 0x1b, 0x1c, 0x2d, 0x26, 
-  0x22, 0x2d, 0x36, 0x32, 0x33, 0x3d, 0x39, 0x34, 0x31, 0x14, 0xfc, 0x09, 0x0b, 0x0c, 0x12, 0x08, 
-  0x13, 0x0b, 0xfd, 0x05, 0x09, 0x06, 0x09, 0x12, 0x14, 0x1a, 0x16, 0x14, 0x19, 0x25, 0x2f, 0x37, 
-  0x28, 0x18, 0x21, 0x21, 0x23, 0x2b, 0x35, 0x30, 0x1f, 0x24, 0x33, 0x35, 0x35, 0x3b, 0x3b, 0x3b, 
-  0x30, 0x20, 0x0e, 0x03, 0x0a, 0x0c, 0x10, 0x11, 0x13, 0x0a, 0x00, 0x05, 0x08, 0x0c, 0x0e, 0x0e, 
-  0x13, 0x18, 0x1d, 0x20, 0x22, 0x27, 0x29, 0x2e, 0x32, 0x35, 0x33, 0x29, 0x29, 0x2f, 0x31, 0x37, 
-  0x3a, 0x3f, 0x44, 0x48, 0x4e, 0x50, 0x54, 0x52, 0x3f, 0x31, 0x2d, 0x19, 0x15, 0x1e, 0x22, 0x27, 
-  0x27, 0x21, 0x19, 0x18, 0x27, 0x2e, 0x24, 0x2c, 0x3a, 0x3b, 0x3a, 0x41, 0x47, 0x45, 0x4e, 0x56, 
-  0x54, 0x57, 0x5a, 0x51, 0x4c, 0x54, 0x56, 0x56, 0x5b, 0x5e, 0x61, 0x66, 0x69, 0x6b, 0x63, 0x49, 
-  0x34, 0x22, 0x11, 0xf9, 0xe4, 0xe6, 0xe6, 0xda, 0xd2, 0xc9, 0xc0, 0xc2, 0xc5, 0xc7, 0xcc, 0xce, 
-  0xd0, 0xd1, 0xd5, 0xd8, 0xdb, 0xde, 0xe0, 0xe4, 0xe6, 0xe8, 0xec, 0xe9, 0xdc, 0xdb, 0xe0, 0xe2, 
-  0xe5, 0xe9, 0xec, 0xee, 0xf1, 0xf4, 0xf7, 0xee, 0xe2, 0xd3, 0xca, 0xd0, 0xc7, 0xb5, 0xb9, 0xbc, 
-  0xc1, 0xb8, 0xad, 0xb1, 0xb8, 0xbd, 0xbe, 0xc0, 0xc5, 0xcc, 0xd4, 0xd4, 0xd1, 0xda, 0xe1, 0xe9, 
-  0xe9, 0xe4, 0xd8, 0xda, 0xd8, 0xc9, 0xcb, 0xd0, 0xd9, 0xdb, 0xde, 0xe4, 0xe4, 0xe9, 0xf0, 0xe6, 
-  0xdf, 0xd1, 0xc5, 0xcc, 0xd3, 0xc6, 0xb7, 0xbe, 0xc4, 0xbc, 0xb1, 0xb9, 0xbc, 0xc3, 0xc7, 0xc6, 
-  0xd4, 0xd8, 0xd3, 0xe1, 0xe9, 0xe3, 0xec, 0xf8, 0xf7, 0xf8, 0x01, 0x05, 0x02, 0xfc, 0xfa, 0xf8, 
-  0x04, 0x0c, 0x0b, 0x0e, 0x11, 0x09, 0x04, 0xfd, 0xf5, 0xed, 0xd8, 0xdd, 0xe8, 0xeb, 0xd7, 0xce, 
-  0xd6, 0xcd, 0xcb, 0xc9, 0xc7, 0xd4, 0xda, 0xd7, 0xde, 0xe6, 0xe8, 0xec, 0xf1, 0xf5, 0xf9, 0xfe, 
-  0x00, 0x06, 0x0a, 0x0c, 0x0f, 0x07, 0x01, 0x03, 0x08, 0x0a, 0x0d, 0x11, 0x14, 0x1a, 0x1d, 0x11, 
-  0x09, 0x07, 0xf4, 0xf2, 0xf7, 0xf7, 0xfb, 0xea, 0xe1, 0xdf, 0xd5, 0xd0, 0xd7, 0xdf, 0xde, 0xe2, 
-  0xe5, 0xe9, 0xec, 0xf1, 0xf3, 0xf9, 0xfb, 0xfb, 0x04, 0x08, 0x09, 0x0c, 0x11, 0x0a, 0x01, 0x03, 
-  0x06, 0x0a, 0x0d, 0x10, 0x14, 0x15, 0x1a, 0x14, 0x0a, 0x08, 0xf9, 0xf3, 0xf9, 0xfb, 0x00, 0xfe, 
-  0xed, 0xe3, 0xd9, 0xd9, 0xdf, 0xe1, 0xe7, 0xea, 0xef, 0xf3, 0xf8, 0xfa, 0xff, 0x05, 0x06, 0x0d, 
-  0x12, 0x15, 0x18, 0x1b, 0x22, 0x24, 0x1b, 0x15, 0x17, 0x1f, 0x22, 0x23, 0x2b, 0x2e, 0x33, 0x2c, 
-  0x1f, 0x21, 0x18, 0x11, 0x12, 0x17, 0x19, 0x1d, 0x20, 0x06, 0xf4, 0xf6, 0xfb, 0x00, 0x04, 0x09, 
-  0x0e, 0x12, 0x16, 0x1c, 0x20, 0x23, 0x27, 0x2d, 0x31, 0x37, 0x3b, 0x3e, 0x41, 0x48, 0x47, 0x3a, 
-  0x39, 0x3e, 0x43, 0x46, 0x4b, 0x4f, 0x53, 0x4d, 0x43, 0x45, 0x3b, 0x2d, 0x31, 0x36, 0x3a, 0x3b, 
-  0x41, 0x38, 0x16, 0x11, 0x19, 0x1c, 0x20, 0x23, 0x28, 0x2b, 0x30, 0x35, 0x38, 0x3c, 0x41, 0x45, 
-  0x47, 0x4c, 0x51, 0x53, 0x57, 0x5b, 0x5e, 0x57, 0x4f, 0x4f, 0x54, 0x58, 0x5d, 0x5f, 0x61, 0x4f, 
-  0x34, 0x32, 0x2e, 0x1f, 0x1b, 0x20, 0x1e, 0x12, 0x0e, 0x0d, 0xe2, 0xbe, 0xc3, 0xc5, 0xc7, 0xcc, 
-  0xcf, 0xd1, 0xd4, 0xd7, 0xda, 0xdf, 0xe2, 0xe3, 0xe6, 0xec, 0xee, 0xef, 0xf5, 0xf8, 0xfa, 0xfa, 
-  0xf0, 0xea, 0xee, 0xf3, 0xf6, 0xfb, 0xfc, 0xf9, 0xef, 0xed, 0xee, 0xdd, 0xd9, 0xdc, 0xe0, 0xe4, 
-  0xe7, 0xe9, 0xe1, 0xca, 0xbc, 0xc2, 0xc6, 0xc9, 0xcd, 0xd2, 0xd5, 0xd9, 0xdd, 0xe1, 0xe5, 0xe9, 
-  0xed, 0xf1, 0xf5, 0xf9, 0xfa, 0xf2, 0xec, 0xee, 0xe9, 0xdf, 0xe1, 0xe4, 0xe9, 0xeb, 0xf0, 0xed, 
-  0xe2, 0xdf, 0xe3, 0xd7, 0xcc, 0xce, 0xd2, 0xd6, 0xd9, 0xdd, 0xd4, 0xcd, 0xba, 0xb2, 0xba, 0xbb, 
-  0xc0, 0xc2, 0xc7, 0xcc, 0xce, 0xd2, 0xd7, 0xd9, 0xdd, 0xe2, 0xe7, 0xea, 0xed, 0xf3, 0xf6, 0xf8, 
-  0xf8, 0xf0, 0xeb, 0xef, 0xeb, 0xe0, 0xe0, 0xe0, 0xd5, 0xd3, 0xd6, 0xce, 0xc0, 0xc1, 0xc4, 0xc8, 
-  0xcc, 0xcf, 0xca, 0xc2, 0xc0, 0xaf, 0xa9, 0xae, 0xb0, 0xb7, 0xbb, 0xbf, 0xc2, 0xc7, 0xcb, 0xcd, 
-  0xd2, 0xd7, 0xdb, 0xdf, 0xe4, 0xe7, 0xeb, 0xef, 0xf4, 0xef, 0xe7, 0xe6, 0xea, 0xef, 0xf5, 0xf4, 
-  0xe9, 0xe5, 0xeb, 0xe9, 0xdb, 0xd6, 0xda, 0xe1, 0xe6, 0xe9, 0xe6, 0xdc, 0xde, 0xde, 0xcc, 0xca, 
-  0xd2, 0xd5, 0xda, 0xde, 0xe3, 0xe7, 0xeb, 0xf0, 0xf6, 0xfa, 0x00, 0x04, 0x09, 0x0d, 0x13, 0x17, 
-  0x1b, 0x1d, 0x16, 0x11, 0x15, 0x18, 0x1c, 0x20, 0x17, 0x12, 0x16, 0x19, 0x0c, 0x04, 0x08, 0x0e, 
-  0x13, 0x16, 0x15, 0x0d, 0x0c, 0x11, 0x0d, 0xfb, 0xfd, 0x04, 0x06, 0x0b, 0x10, 0x14, 0x15, 0x1b, 
-  0x21, 0x26, 0x29, 0x2e, 0x33, 0x37, 0x3b, 0x3f, 0x43, 0x47, 0x45, 0x3c, 0x39, 0x3e, 0x41, 0x44, 
-  0x3a, 0x34, 0x38, 0x3c, 0x33, 0x25, 0x27, 0x2b, 0x30, 0x33, 0x34, 0x29, 0x26, 0x29, 0x2f, 0x28, 
-  0x16, 0x19, 0x1d, 0x21, 0x25, 0x28, 0x2c, 0x31, 0x34, 0x37, 0x3c, 0x40, 0x44, 0x48, 0x4b, 0x4d, 
-  0x52, 0x55, 0x57, 0x4f, 0x46, 0x47, 0x4a, 0x4d, 0x44, 0x3c, 0x3d, 0x41, 0x3e, 0x2e, 0x2a, 0x2e, 
-  0x33, 0x35, 0x35, 0x2c, 0x25, 0x28, 0x2a, 0x31, 0x23, 0x13, 0x19, 0x1b, 0x1d, 0x20, 0x24, 0x28, 
-  0x2b, 0x2e, 0x32, 0x35, 0x39, 0x3c, 0x3f, 0x42, 0x46, 0x4a, 0x4b, 0x4c, 0x41, 0x3b, 0x3d, 0x42, 
-  0x37, 0x1c, 0x11, 0x16, 0x17, 0x07, 0xfe, 0xf7, 0xf0, 0xf1, 0xf4, 0xec, 0xe4, 0xe5, 0xe9, 0xea, 
-  0xf0, 0xd6, 0xb2, 0xb6, 0xbb, 0xbd, 0xbf, 0xc3, 0xc6, 0xc9, 0xcb, 0xd1, 0xd4, 0xd7, 0xda, 0xde, 
-  0xe1, 0xe4, 0xe8, 0xeb, 0xe6, 0xdd, 0xdd, 0xe0, 0xdc, 0xd2, 0xd4, 0xd7, 0xdb, 0xd4, 0xc7, 0xc7, 
-  0xcd, 0xd2, 0xd6, 0xd1, 0xc7, 0xc8, 0xcd, 0xd2, 0xd5, 0xd8, 0xc7, 0xbf, 0xc6, 0xca, 0xd0, 0xd4, 
-  0xd7, 0xdb, 0xe1, 0xe5, 0xe8, 0xee, 0xf4, 0xf8, 0xf8, 0xf1, 0xed, 0xef, 0xf3, 0xeb, 0xe3, 0xe8, 
-  0xe6, 0xdb, 0xda, 0xe0, 0xe4, 0xe1, 0xd3, 0xd2, 0xd7, 0xdb, 0xdf, 0xdf, 0xd4, 0xd3, 0xd8, 0xdd, 
-  0xe0, 0xe4, 0xe6, 0xd3, 0xd0, 0xd8, 0xdb, 0xdf, 0xe3, 0xe8, 0xec, 0xf0, 0xf3, 0xf9, 0xfe, 0x03, 
-  0x06, 0x0a, 0x0e, 0x12, 0x11, 0x04, 0xf3, 0xf0, 0xf0, 0xe6, 0xe5, 0xe8, 0xed, 0xee, 0xe1, 0xda, 
-  0xde, 0xe1, 0xe6, 0xe6, 0xde, 0xd8, 0xdc, 0xe1, 0xe5, 0xe8, 0xec, 0xeb, 0xd8, 0xd6, 0xdd, 0xe0, 
-  0xe5, 0xe7, 0xec, 0xf0, 0xf4, 0xf7, 0xfc, 0x00, 0x03, 0x07, 0x0a, 0x0d, 0x11, 0x14, 0x10, 0x07, 
-  0x04, 0xfb, 0xf5, 0xfb, 0xff, 0x02, 0xfa, 0xee, 0xee, 0xf2, 0xf6, 0xfa, 0xf3, 0xec, 0xed, 0xf3, 
-  0xf6, 0xfa, 0xfc, 0x02, 0xfb, 0xe9, 0xeb, 0xf0, 0xf3, 0xf7, 0xf9, 0xfd, 0x01, 0x05, 0x08, 0x0c, 
-  0x0f, 0x14, 0x17, 0x1b, 0x1e, 0x22, 0x23, 0x1b, 0x14, 0x0a, 0x03, 0x07, 0x0b, 0x0f, 0x0c, 0xfd, 
-  0xf8, 0xfe, 0x01, 0x04, 0x01, 0xf7, 0xf7, 0xfb, 0xff, 0x02, 0x06, 0x08, 0x0e, 0x05, 0xf4, 0xf8, 
-  0xfd, 0x00, 0x02, 0x07, 0x0b, 0x0d, 0x10, 0x14, 0x18, 0x1a, 0x1f, 0x22, 0x26, 0x28, 0x2c, 0x2a, 
-  0x20, 0x13, 0x0a, 0x0c, 0x11, 0x16, 0x17, 0x0a, 0x01, 0x05, 0x07, 0x0c, 0x0c, 0x02, 0x00, 0x04, 
-  0x07, 0x0b, 0x0f, 0x12, 0x15, 0x1b, 0x0d, 0xfe, 0x05, 0x09, 0x0d, 0x0f, 0x13, 0x18, 0x1c, 0x1e, 
-  0x21, 0x26, 0x2a, 0x2d, 0x32, 0x36, 0x38, 0x3b, 0x37, 0x26, 0x19, 0x1b, 0x1f, 0x23, 0x26, 0x21, 
-  0x13, 0x12, 0x16, 0x1b, 0x1d, 0x14, 0x11, 0x15, 0x17, 0x1c, 0x20, 0x24, 0x27, 0x2b, 0x2e, 0x1e, 
-  0x13, 0x1b, 0x20, 0x23, 0x25, 0x2a, 0x2e, 0x32, 0x35, 0x39, 0x3d, 0x41, 0x46, 0x4a, 0x4e, 0x51, 
-  0x54, 0x45, 0x31, 0x24, 0x18, 0x17, 0x1c, 0x1b, 0x0a, 0xf5, 0xf3, 0xf6, 0xfa, 0xf5, 0xec, 0xee, 
-  0xf2, 0xf5, 0xf8, 0xfc, 0xff, 0x03, 0x07, 0x07, 0xf3, 0xd8, 0xd2, 0xd8, 0xdb, 0xdd, 0xe2, 0xe4, 
-  0xe8, 0xea, 0xef, 0xf4, 0xf7, 0xfa, 0xfe, 0x02, 0x05, 0xff, 0xe9, 0xe0, 0xe3, 0xe7, 0xeb, 0xef, 
-  0xe6, 0xd8, 0xda, 0xdf, 0xe4, 0xe0, 0xd7, 0xd8, 0xdb, 0xdf, 0xe2, 0xe7, 0xea, 0xee, 0xf1, 0xf5, 
-  0xf5, 0xe1, 0xe0, 0xe6, 0xe8, 0xec, 0xf0, 0xf4, 0xf7, 0xfc, 0xff, 0x04, 0x07, 0x08, 0xff, 0xfb, 
-  0xfe, 0x00, 0xef, 0xde, 0xdc, 0xe1, 0xe4, 0xe8, 0xe7, 0xd8, 0xd3, 0xd7, 0xdb, 0xdb, 0xd4, 0xcf, 
-  0xd3, 0xd8, 0xdb, 0xde, 0xe3, 0xe5, 0xea, 0xed, 0xf1, 0xec, 0xda, 0xdb, 0xe0, 0xe4, 0xe8, 0xea, 
-  0xef, 0xf3, 0xf7, 0xfa, 0x00, 0xfb, 0xf3, 0xf2, 0xf6, 0xf8, 0xf0, 0xde, 0xd6, 0xd8, 0xdc, 0xe0, 
-  0xe1, 0xd6, 0xcd, 0xcf, 0xd2, 0xd8, 0xd1, 0xc8, 0xcb, 0xd0, 0xd4, 0xd8, 0xdb, 0xde, 0xe0, 0xe5, 
-  0xe8, 0xec, 0xe3, 0xd2, 0xd7, 0xdc, 0xdf, 0xe2, 0xe6, 0xea, 0xee, 0xf2, 0xf6, 0xfb, 0xff, 0x02, 
-  0x06, 0x0c, 0x06, 0xfa, 0xef, 0xeb, 0xed, 0xf1, 0xf6, 0xf1, 0xe2, 0xe0, 0xe4, 0xe8, 0xe6, 0xdd, 
-  0xdd, 0xe0, 0xe5, 0xe9, 0xed, 0xf1, 0xf6, 0xf8, 0xfc, 0xfd, 0x02, 0xf7, 0xe8, 0xee, 0xf1, 0xf5, 
-  0xf9, 0xfc, 0xff, 0x03, 0x07, 0x0b, 0x0f, 0x13, 0x16, 0x1b, 0x18, 0x0f, 0x09, 0x00, 0xff, 0x02, 
-  0x07, 0x06, 0xfb, 0xf3, 0xf4, 0xf9, 0xfb, 0xf0, 0xee, 0xf1, 0xf6, 0xfb, 0xfe, 0x02, 0x05, 0x08, 
-  0x0b, 0x0f, 0x11, 0x15, 0x07, 0xfb, 0x02, 0x05, 0x09, 0x0b, 0x0f, 0x13, 0x16, 0x19, 0x1e, 0x21, 
-  0x23, 0x28, 0x2b, 0x22, 0x1d, 0x18, 0x0f, 0x11, 0x13, 0x18, 0x12, 0x04, 0x03, 0x08, 0x0c, 0x06, 
-  0xff, 0x01, 0x05, 0x0a, 0x0e, 0x11, 0x15, 0x19, 0x1b, 0x1e, 0x23, 0x25, 0x27, 0x18, 0x10, 0x17, 
-  0x1a, 0x1e, 0x21, 0x25, 0x28, 0x2c, 0x30, 0x35, 0x39, 0x3c, 0x3d, 0x37, 0x32, 0x33, 0x2c, 0x25, 
-  0x26, 0x2a, 0x2b, 0x20, 0x1a, 0x1b, 0x20, 0x1e, 0x16, 0x15, 0x19, 0x1d, 0x22, 0x25, 0x29, 0x2d, 
-  0x31, 0x34, 0x37, 0x3a, 0x3e, 0x3e, 0x2b, 0x26, 0x2e, 0x30, 0x34, 0x38, 0x3c, 0x3e, 0x41, 0x47, 
-  0x4c, 0x4e, 0x52, 0x4e, 0x45, 0x45, 0x3e, 0x27, 0x1a, 0x1b, 0x1d, 0x0d, 0xf6, 0xf3, 0xf7, 0xf8, 
-  0xf0, 0xec, 0xef, 0xf2, 0xf6, 0xfa, 0xfd, 0x02, 0x03, 0x07, 0x08, 0x0d, 0x10, 0x13, 0x11, 0xfd, 
-  0xf3, 0xe4, 0xe2, 0xe8, 0xe8, 0xec, 0xee, 0xf1, 0xf6, 0xf8, 0xfb, 0xf9, 0xf1, 0xf1, 0xf3, 0xf1, 
-  0xe8, 0xe6, 0xe8, 0xe8, 0xdc, 0xd5, 0xd8, 0xdb, 0xd7, 0xd0, 0xd0, 0xd4, 0xda, 0xdd, 0xe1, 0xe4, 
-  0xea, 0xeb, 0xef, 0xf2, 0xf7, 0xf9, 0xfe, 0xf9, 0xe7, 0xe9, 0xee, 0xf1, 0xf6, 0xf8, 0xfb, 0xfe, 
-  0x03, 0x06, 0x0a, 0x04, 0xf0, 0xe8, 0xea, 0xee, 0xec, 0xe3, 0xe1, 0xe3, 0xdc, 0xd1, 0xd0, 0xd4, 
-  0xd4, 0xcc, 0xc9, 0xca, 0xd0, 0xd5, 0xd7, 0xda, 0xdf, 0xe4, 0xe6, 0xea, 0xed, 0xf2, 0xf4, 0xf9, 
-  0xf0, 0xe1, 0xe6, 0xe9, 0xed, 0xf1, 0xf3, 0xed, 0xe6, 0xe8, 0xeb, 0xec, 0xe5, 0xe2, 0xe4, 0xe6, 
-  0xe9, 0xe5, 0xde, 0xdd, 0xdc, 0xd1, 0xca, 0xcd, 0xce, 0xc7, 0xc3, 0xc5, 0xc8, 0xcd, 0xd1, 0xd4, 
-  0xd6, 0xdc, 0xe0, 0xe2, 0xe6, 0xe9, 0xee, 0xf0, 0xf4, 0xe7, 0xdb, 0xe1, 0xe5, 0xe8, 0xec, 0xf1, 
-  0xf3, 0xf7, 0xfb, 0xff, 0xfa, 0xf2, 0xf4, 0xf7, 0xfc, 0xfe, 0xf6, 0xf0, 0xf2, 0xea, 0xe1, 0xe0, 
-  0xe2, 0xdf, 0xd7, 0xd5, 0xd8, 0xdd, 0xe2, 0xe5, 0xe8, 0xeb, 0xef, 0xf3, 0xf7, 0xfa, 0xff, 0x04, 
-  0x06, 0x0a, 0xfa, 0xf0, 0xf8, 0xfa, 0xfe, 0x03, 0x06, 0x08, 0x0c, 0x0f, 0x0f, 0x07, 0x05, 0x07, 
-  0x0c, 0x11, 0x0f, 0x07, 0x04, 0x02, 0xf7, 0xf1, 0xf4, 0xf6, 0xef, 0xec, 0xef, 0xf4, 0x00, 0xfa, 
-  0xff, 0x16, 0x0c, 0x15, 0x30, 0x28, 0xf9, 0xe5, 0x17, 0x18, 0xfb, 0xf6, 0xda, 0xe8, 0xff, 0xf6, 
-  0xf6, 0x0e, 0x10, 0xfe, 0x18, 0x1d, 0x0f, 0x02, 0x16, 0x3b, 0x29, 0x12, 0x1b, 0x32, 0x25, 0x06, 
-  0x14, 0x23, 0x19, 0x19, 0x15, 0x1d, 0x30, 0x29, 0x2a, 0x32, 0x1a, 0xfe, 0x0a, 0x10, 0xff, 0xfe, 
-  0x12, 0x17, 0x12, 0x1d, 0x0c, 0x0e, 0x18, 0x13, 0x25, 0x2b, 0x2d, 0x36, 0x3b, 0x31, 0x31, 0x38, 
-  0x3c, 0x45, 0x43, 0x45, 0x45, 0x49, 0x4e, 0x49, 0x30, 0x27, 0x3b, 0x39, 0x39, 0x39, 0x2d, 0x10, 
-  0xff, 0x03, 0x04, 0x0a, 0x07, 0x07, 0x09, 0x0e, 0x12, 0x1d, 0x23, 0x26, 0x26, 0x19, 0x1e, 0x26, 
-  0x2c, 0x32, 0x36, 0x3f, 0x43, 0x44, 0x3d, 0x3e, 0x44, 0x4d, 0x50, 0x47, 0x45, 0x40, 0x36, 0x28, 
-  0x1e, 0x0d, 0x03, 0xf2, 0xdf, 0xd3, 0xc2, 0xcc, 0xca, 0xc3, 0xc7, 0xcf, 0xd9, 0xdb, 0xe6, 0xf0, 
-  0xf6, 0x00, 0x09, 0x0c, 0x13, 0x14, 0x0a, 0x11, 0x05, 0xfd, 0x05, 0x07, 0x19, 0x1a, 0x08, 0x10, 
-  0x1e, 0x1e, 0x22, 0x2c, 0x33, 0x1d, 0x16, 0x0b, 0xe1, 0xc1, 0xb7, 0xbe, 0xb7, 0xad, 0xad, 0xb3, 
-  0xbd, 0xc3, 0xcb, 0xd4, 0xdb, 0xe1, 0xe9, 0xf2, 0xfa, 0xff, 0x05, 0x0d, 0x11, 0x18, 0x13, 0x0a, 
-  0x11, 0x1a, 0x1f, 0x23, 0x29, 0x2e, 0x2b, 0x28, 0x26, 0x16, 0x07, 0x06, 0xe6, 0xc4, 0xc3, 0xc2, 
-  0xb5, 0x9e, 0x9b, 0xa0, 0xa0, 0xa0, 0xa5, 0xaa, 0xb1, 0xba, 0xc1, 0xc8, 0xcf, 0xd5, 0xdd, 0xe3, 
-  0xea, 0xf1, 0xf8, 0xfe, 0x03, 0x0a, 0x10, 0x09, 0x03, 0x08, 0x01, 0x02, 0xfd, 0xf0, 0xe6, 0xe3, 
-  0xbf, 0x9d, 0xaa, 0xac, 0xa9, 0xa5, 0xaa, 0xb2, 0xa8, 0x9c, 0x99, 0xa7, 0xad, 0xa4, 0xa7, 0xaf, 
-  0xba, 0xbf, 0xc6, 0xd0, 0xd2, 0xdc, 0xe5, 0xec, 0xf5, 0xfb, 0x00, 0x0c, 0x12, 0x16, 0x1a, 0x24, 
-  0x12, 0xf9, 0xff, 0x05, 0xe4, 0xc6, 0xc5, 0xc2, 0xc8, 0xb9, 0xb4, 0xc8, 0xcf, 0xd0, 0xdd, 0xea, 
-  0xe7, 0xe0, 0xdc, 0xdd, 0xe2, 0xe9, 0xe4, 0xe5, 0xf5, 0xfd, 0xfe, 0x05, 0x0c, 0x16, 0x1c, 0x22, 
-  0x2a, 0x31, 0x31, 0x3b, 0x39, 0x2b, 0x2e, 0x2a, 0x10, 0xec, 0xe9, 0xed, 0xeb, 0xea, 0xe8, 0xe2, 
-  0xe3, 0xeb, 0xef, 0xf7, 0xfe, 0x06, 0x0c, 0x15, 0x1a, 0x1c, 0x13, 0x0c, 0x10, 0x14, 0x15, 0x16, 
-  0x1d, 0x21, 0x28, 0x2d, 0x33, 0x3b, 0x40, 0x3e, 0x37, 0x30, 0x32, 0x21, 0x0f, 0x05, 0xf7, 0xfe, 
-  0x01, 0xf3, 0xe4, 0xe3, 0xf0, 0xf7, 0xf8, 0xfa, 0xf8, 0xfa, 0x00, 0x07, 0x0c, 0x16, 0x19, 0x1d, 
-  0x29, 0x2f, 0x2a, 0x20, 0x1d, 0x1c, 0x1f, 0x21, 0x24, 0x29, 0x2d, 0x30, 0x23, 0x1c, 0x1f, 0x09, 
-  0xfe, 0x02, 0xf2, 0xf0, 0xf7, 0xee, 0xeb, 0xef, 0xf7, 0xff, 0xfd, 0xf9, 0xff, 0x06, 0x0c, 0x10, 
-  0x10, 0x11, 0x16, 0x19, 0x23, 0x2c, 0x30, 0x39, 0x42, 0x48, 0x4a, 0x45, 0x3f, 0x3e, 0x40, 0x3c, 
-  0x2a, 0x2c, 0x22, 0x0b, 0x0a, 0x11, 0x08, 0xfc, 0x01, 0xfa, 0xfb, 0x01, 0x05, 0x0d, 0x12, 0x1a, 
-  0x26, 0x2a, 0x2e, 0x2f, 0x2b, 0x31, 0x38, 0x3e, 0x3f, 0x3e, 0x41, 0x49, 0x4f, 0x54, 0x5d, 0x5c, 
-  0x55, 0x55, 0x55, 0x44, 0x22, 0x17, 0x06, 0xed, 0xe9, 0xef, 0xee, 0xdb, 0xdd, 0xd9, 0xd2, 0xd6, 
-  0xdd, 0xe6, 0xea, 0xf0, 0xf7, 0xfe, 0x05, 0x09, 0x10, 0x16, 0x1b, 0x21, 0x20, 0x1c, 0x22, 0x22, 
-  0x0e, 0x05, 0x0c, 0x0e, 0x13, 0x19, 0x21, 0x1c, 0x0d, 0x0e, 0xfd, 0xee, 0xed, 0xe4, 0xe0, 0xcc, 
-  0xc0, 0xba, 0xb1, 0xb8, 0xbd, 0xc4, 0xca, 0xd0, 0xd8, 0xe0, 0xe6, 0xec, 0xf0, 0xf9, 0xff, 0x04, 
-  0x0b, 0x0f, 0x18, 0x1c, 0x1f, 0x1c, 0x1a, 0x21, 0x26, 0x23, 0x24, 0x1a, 0x0e, 0x08, 0xf7, 0xee, 
-  0xf3, 0xf3, 0xef, 0xe1, 0xd5, 0xc9, 0xb4, 0xb0, 0xb3, 0xb2, 0xb7, 0xbd, 0xc3, 0xca, 0xce, 0xd5, 
-  0xdb, 0xe2, 0xe9, 0xed, 0xf5, 0xf9, 0x00, 0x07, 0x0c, 0x13, 0x18, 0x1d, 0x1f, 0x17, 0x0c, 0xf9, 
-  0xee, 0xe0, 0xc9, 0xc3, 0xc8, 0xcc, 0xd3, 0xd4, 0xc5, 0xbd, 0xb7, 0xb8, 0xbf, 0xc3, 0xc0, 0xbb, 
-  0xbb, 0xbb, 0xbf, 0xc3, 0xc9, 0xce, 0xd4, 0xd9, 0xdf, 0xe5, 0xed, 0xf5, 0xf9, 0xfe, 0x04, 0x09, 
-  0x0f, 0x14, 0x18, 0x0e, 0xfc, 0xf1, 0xe2, 0xd5, 0xd6, 0xda, 0xd9, 0xdd, 0xce, 0xbf, 0xb8, 0xb6, 
-  0xbe, 0xc6, 0xcd, 0xd1, 0xd8, 0xe0, 0xe1, 0xdb, 0xd7, 0xd8, 0xd9, 0xdd, 0xe3, 0xe8, 0xee, 0xf2, 
-  0xf8, 0xfe, 0x03, 0x09, 0x0f, 0x15, 0x16, 0x09, 0xf9, 0xec, 0xe3, 0xe4, 0xe9, 0xef, 0xf4, 0xf6, 
-  0xe9, 0xd4, 0xc5, 0xbf, 0xc2, 0xca, 0xcf, 0xd2, 0xd9, 0xe0, 0xe6, 0xed, 0xf3, 0xf9, 0xfd, 0xfe, 
-  0xfc, 0xf9, 0xfa, 0xfc, 0x00, 0x09, 0x10, 0x13, 0x17, 0x1e, 0x20, 0x13, 0x02, 0xf6, 0xee, 0xf2, 
-  0xf7, 0xfc, 0x03, 0x09, 0x0c, 0xfb, 0xe8, 0xe9, 0xe9, 0xe8, 0xeb, 0xed, 0xf1, 0xf7, 0xfd, 0x04, 
-  0x09, 0x10, 0x17, 0x1e, 0x24, 0x2b, 0x32, 0x34, 0x32, 0x31, 0x30, 0x31, 0x36, 0x39, 0x3a, 0x29, 
-  0x18, 0x0e, 0x08, 0x0c, 0x13, 0x19, 0x20, 0x26, 0x2d, 0x22, 0x08, 0x06, 0x0d, 0x11, 0x17, 0x1e, 
-  0x24, 0x24, 0x21, 0x25, 0x29, 0x2d, 0x31, 0x39, 0x41, 0x46, 0x4a, 0x51, 0x58, 0x5e, 0x66, 0x6a, 
-  0x6b, 0x69, 0x62, 0x45, 0x31, 0x29, 0x22, 0x26, 0x2b, 0x30, 0x36, 0x3c, 0x41, 0x41, 0x27, 0x1a, 
-  0x20, 0x24, 0x2a, 0x30, 0x35, 0x3a, 0x41, 0x47, 0x4c, 0x50, 0x4f, 0x4c, 0x4f, 0x53, 0x57, 0x5d, 
-  0x61, 0x66, 0x6b, 0x71, 0x6e, 0x66, 0x58, 0x33, 0x1c, 0x0d, 0x01, 0xff, 0xfb, 0xfe, 0x01, 0x06, 
-  0x07, 0x0c, 0xf5, 0xdd, 0xe2, 0xe5, 0xe9, 0xef, 0xf4, 0xf7, 0xfb, 0x01, 0x06, 0x09, 0x0e, 0x15, 
-  0x18, 0x1b, 0x1f, 0x1a, 0x16, 0x19, 0x1d, 0x13, 0x05, 0x0b, 0x02, 0xe5, 0xdd, 0xd5, 0xcf, 0xd3, 
-  0xd8, 0xdc, 0xd9, 0xdb, 0xd7, 0xd7, 0xc9, 0xaa, 0xab, 0xb0, 0xb3, 0xba, 0xbf, 0xc3, 0xc8, 0xce, 
-  0xd5, 0xda, 0xdf, 0xe4, 0xea, 0xf1, 0xf4, 0xfa, 0xff, 0x03, 0x06, 0x09, 0x04, 0x05, 0xf7, 0xdc, 
-  0xd6, 0xce, 0xcc, 0xd2, 0xd5, 0xda, 0xdf, 0xe6, 0xe7, 0xe2, 0xd7, 0xb3, 0xa3, 0xa6, 0xa7, 0xac, 
-  0xaf, 0xb5, 0xbb, 0xbf, 0xc4, 0xcb, 0xd0, 0xd5, 0xda, 0xe2, 0xe7, 0xec, 0xf0, 0xf6, 0xfb, 0x00, 
-  0xfd, 0xf9, 0xe4, 0xca, 0xc1, 0xb0, 0xae, 0xb3, 0xb7, 0xbc, 0xc5, 0xc8, 0xcd, 0xd3, 0xda, 0xc3, 
-  0xac, 0xb5, 0xb9, 0xbb, 0xbe, 0xbd, 0xbc, 0xc0, 0xc6, 0xcb, 0xd1, 0xd8, 0xdc, 0xe3, 0xe9, 0xee, 
-  0xf4, 0xf8, 0xfe, 0x05, 0x0a, 0x0e, 0xfb, 0xe8, 0xe4, 0xdc, 0xde, 0xe1, 0xe5, 0xe4, 0xe1, 0xe5, 
-  0xed, 0xf2, 0xf8, 0xeb, 0xce, 0xce, 0xd7, 0xdc, 0xe3, 0xe7, 0xec, 0xee, 0xf3, 0xf6, 0xf8, 0xf9, 
-  0xfb, 0xff, 0x07, 0x0c, 0x11, 0x14, 0x18, 0x1f, 0x24, 0x24, 0x0f, 0xfe, 0xf9, 0xf0, 0xf3, 0xfa, 
-  0xfe, 0x02, 0x08, 0x0f, 0x12, 0x14, 0x14, 0x0b, 0xee, 0xe2, 0xec, 0xf1, 0xf6, 0xf9, 0xfd, 0x02, 
-  0x09, 0x0e, 0x14, 0x18, 0x1a, 0x1d, 0x20, 0x22, 0x22, 0x24, 0x26, 0x2e, 0x33, 0x2e, 0x18, 0x0b, 
-  0x06, 0xfe, 0x00, 0x06, 0x0b, 0x0f, 0x12, 0x18, 0x1e, 0x23, 0x27, 0x28, 0x14, 0xfc, 0xfe, 0xff, 
-  0xfe, 0x03, 0x07, 0x0c, 0x12, 0x18, 0x1c, 0x21, 0x26, 0x2c, 0x30, 0x34, 0x37, 0x39, 0x39, 0x3b, 
-  0x3c, 0x30, 0x19, 0x0f, 0x09, 0x01, 0x04, 0x08, 0x0c, 0x12, 0x15, 0x19, 0x1f, 0x23, 0x28, 0x29, 
-  0x1f, 0x06, 0x01, 0x0b, 0x0e, 0x13, 0x12, 0x14, 0x15, 0x16, 0x1b, 0x22, 0x27, 0x2c, 0x30, 0x35, 
-  0x39, 0x3f, 0x42, 0x47, 0x47, 0x3b, 0x28, 0x1b, 0x12, 0x08, 0x07, 0x0b, 0x11, 0x16, 0x1b, 0x1d, 
-  0x24, 0x29, 0x2d, 0x2f, 0x29, 0x16, 0x08, 0x10, 0x13, 0x18, 0x1e, 0x22, 0x26, 0x2c, 0x2e, 0x30, 
-  0x36, 0x36, 0x37, 0x3c, 0x42, 0x47, 0x4b, 0x4d, 0x4c, 0x3d, 0x22, 0x0a, 0xf8, 0xe9, 0xe7, 0xe9, 
-  0xee, 0xf1, 0xf1, 0xf2, 0xf6, 0xfa, 0xff, 0x03, 0xfe, 0xf0, 0xdb, 0xdb, 0xe1, 0xe5, 0xec, 0xef, 
-  0xf4, 0xf9, 0xfe, 0x04, 0x0a, 0x0f, 0x11, 0x13, 0x16, 0x1a, 0x1a, 0x1d, 0x19, 0x10, 0x00, 0xe1, 
-  0xcf, 0xcd, 0xcf, 0xd4, 0xdb, 0xdf, 0xe0, 0xe3, 0xe6, 0xe8, 0xec, 0xf0, 0xe8, 0xe0, 0xcd, 0xc6, 
-  0xcd, 0xd0, 0xd6, 0xd8, 0xdd, 0xe2, 0xe8, 0xee, 0xf5, 0xfa, 0xfe, 0x03, 0x09, 0x0f, 0x14, 0x15, 
-  0x0a, 0x01, 0xf7, 0xe9, 0xdf, 0xdb, 0xdf, 0xe5, 0xec, 0xef, 0xf3, 0xf9, 0xfd, 0x02, 0x05, 0x09, 
-  0xfe, 0xeb, 0xdb, 0xc9, 0xcb, 0xce, 0xd3, 0xd8, 0xdb, 0xdf, 0xe3, 0xe9, 0xed, 0xf0, 0xf5, 0xfc, 
-  0x01, 0x05, 0x0a, 0x08, 0xf4, 0xe8, 0xdd, 0xd2, 0xc8, 0xc2, 0xc6, 0xc9, 0xcb, 0xce, 0xd4, 0xd9, 
-  0xdc, 0xe1, 0xe5, 0xea, 0xec, 0xe4, 0xdd, 0xc8, 0xc4, 0xcb, 0xcc, 0xd0, 0xd2, 0xd4, 0xd6, 0xdc, 
-  0xe2, 0xe7, 0xea, 0xef, 0xf3, 0xf6, 0xfc, 0xfe, 0xf4, 0xf1, 0xe7, 0xde, 0xd5, 0xd1, 0xd6, 0xd9, 
-  0xdd, 0xe1, 0xe5, 0xe8, 0xeb, 0xec, 0xf2, 0xf4, 0xfa, 0xf3, 0xed, 0xdf, 0xd3, 0xd9, 0xdd, 0xe3, 
-  0xe5, 0xe8, 0xeb, 0xef, 0xf3, 0xf7, 0xfa, 0xfd, 0x01, 0x06, 0x0c, 0x0a, 0x01, 0xff, 0xf5, 0xe8, 
-  0xe0, 0xde, 0xe2, 0xe7, 0xed, 0xf2, 0xf8, 0xfc, 0x00, 0x01, 0x05, 0x09, 0x0f, 0x09, 0x00, 0xf9, 
-  0xe7, 0xea, 0xef, 0xf3, 0xf7, 0xfb, 0x00, 0x03, 0x07, 0x0a, 0x0e, 0x11, 0x16, 0x1a, 0x1c, 0x17, 
-  0x10, 0x0f, 0x06, 0xfa, 0xef, 0xeb, 0xf0, 0xf4, 0xfa, 0x00, 0x06, 0x0a, 0x0f, 0x14, 0x19, 0x1e, 
-  0x21, 0x1e, 0x15, 0x12, 0x00, 0xfb, 0xff, 0xff, 0x06, 0x09, 0x0d, 0x11, 0x16, 0x19, 0x1e, 0x23, 
-  0x27, 0x2a, 0x2c, 0x24, 0x1e, 0x20, 0x17, 0x08, 0xfb, 0xf7, 0xfd, 0x04, 0x07, 0x0c, 0x11, 0x14, 
-  0x19, 0x1e, 0x23, 0x29, 0x2c, 0x2f, 0x27, 0x24, 0x1a, 0x0a, 0x0e, 0x11, 0x16, 0x1b, 0x1d, 0x1d, 
-  0x20, 0x24, 0x29, 0x2f, 0x33, 0x38, 0x3b, 0x32, 0x2d, 0x32, 0x29, 0x19, 0x0b, 0x08, 0x0d, 0x12, 
-  0x16, 0x19, 0x1f, 0x23, 0x27, 0x2d, 0x31, 0x35, 0x39, 0x3c, 0x36, 0x31, 0x30, 0x1e, 0x1e, 0x24, 
-  0x26, 0x2a, 0x2d, 0x2f, 0x32, 0x38, 0x3c, 0x40, 0x43, 0x47, 0x47, 0x40, 0x3e, 0x42, 0x35, 0x19, 
-  0xfc, 0xec, 0xe9, 0xec, 0xf1, 0xf5, 0xfb, 0xff, 0x03, 0x05, 0x08, 0x0d, 0x10, 0x12, 0x0f, 0x06, 
-  0x07, 0xf8, 0xed, 0xf5, 0xf9, 0xfc, 0x00, 0x05, 0x07, 0x0b, 0x0d, 0x12, 0x16, 0x1b, 0x19, 0x12, 
-  0x10, 0x12, 0x0c, 0x00, 0xf2, 0xed, 0xe3, 0xd5, 0xda, 0xdf, 0xe3, 0xe8, 0xea, 0xeb, 0xf2, 0xf5, 
-  0xf8, 0xfb, 0xfb, 0xf0, 0xef, 0xea, 0xd8, 0xda, 0xdf, 0xe2, 0xe6, 0xe9, 0xed, 0xf3, 0xf7, 0xfd, 
-  0x01, 0x05, 0x00, 0xf9, 0xfa, 0xfe, 0xfb, 0xeb, 0xdd, 0xd7, 0xd9, 0xdf, 0xe4, 0xe9, 0xed, 0xf3, 
-  0xf8, 0xfa, 0x00, 0x03, 0x06, 0x08, 0x0a, 0xff, 0xf0, 0xec, 0xd7, 0xd2, 0xda, 0xdb, 0xdf, 0xe2, 
-  0xe4, 0xe6, 0xe9, 0xee, 0xf3, 0xf8, 0xef, 0xe0, 0xdd, 0xde, 0xd9, 0xcb, 0xbc, 0xb6, 0xba, 0xc1, 
-  0xc6, 0xcb, 0xce, 0xd2, 0xd8, 0xda, 0xde, 0xe3, 0xe7, 0xea, 0xed, 0xea, 0xe1, 0xe2, 0xd5, 0xc8, 
-  0xd0, 0xd4, 0xd6, 0xd9, 0xdb, 0xde, 0xe0, 0xe5, 0xea, 0xee, 0xe6, 0xe0, 0xe4, 0xec, 0xe8, 0xda, 
-  0xcd, 0xc8, 0xc9, 0xcf, 0xd5, 0xd9, 0xdd, 0xe2, 0xe8, 0xee, 0xf2, 0xf4, 0xf6, 0xfa, 0xfe, 0xfd, 
-  0xf5, 0xf6, 0xf3, 0xdf, 0xdf, 0xe7, 0xe7, 0xe8, 0xec, 0xf2, 0xf5, 0xf9, 0xfe, 0x01, 0xf7, 0xf2, 
-  0xf6, 0xfb, 0xfa, 0xec, 0xdd, 0xd6, 0xda, 0xdf, 0xe5, 0xec, 0xf1, 0xf3, 0xf8, 0xfd, 0x01, 0x05, 
-  0x09, 0x0d, 0x13, 0x15, 0x0d, 0x06, 0x09, 0xfb, 0xf1, 0xf8, 0xfb, 0xfd, 0x00, 0x03, 0x05, 0x08, 
-  0x0c, 0x0e, 0x07, 0x05, 0x09, 0x0e, 0x0c, 0xfe, 0xee, 0xe7, 0xe9, 0xed, 0xf3, 0xf9, 0xff, 0x03, 
-  0x08, 0x0e, 0x13, 0x16, 0x19, 0x1c, 0x21, 0x23, 0x20, 0x18, 0x1a, 0x15, 0x04, 0x05, 0x08, 0x0b, 
-  0x0e, 0x11, 0x16, 0x1a, 0x1e, 0x1e, 0x15, 0x10, 0x13, 0x19, 0x1a, 0x0f, 0x01, 0xf7, 0xf8, 0xfc, 
-  0x04, 0x0b, 0x11, 0x17, 0x1d, 0x24, 0x2d, 0x31, 0x3a, 0x33, 0x21, 0x1c, 0x18, 0x12, 0x12, 0x14, 
-  0x04, 0x02, 0x0b, 0x0f, 0x17, 0x1d, 0x23, 0x29, 0x31, 0x32, 0x2e, 0x31, 0x38, 0x41, 0x44, 0x3c, 
-  0x2f, 0x2a, 0x2d, 0x35, 0x29, 0x03, 0xf7, 0xfd, 0x03, 0x0b, 0x13, 0x1b, 0x22, 0x2a, 0x31, 0x3a, 
-  0x3f, 0x3d, 0x3c, 0x42, 0x3b, 0x32, 0x39, 0x3f, 0x44, 0x4a, 0x51, 0x58, 0x5f, 0x5e, 0x57, 0x45, 
-  0x1e, 0x0e, 0x15, 0x0b, 0xf3, 0xdc, 0xd3, 0xd6, 0xdb, 0xe3, 0xec, 0xf5, 0xfc, 0x04, 0x0c, 0x13, 
-  0x18, 0x1e, 0x24, 0x2b, 0x32, 0x30, 0x2d, 0x32, 0x33, 0x1e, 0x0c, 0xed, 0xd6, 0xe0, 0xe6, 0xed, 
-  0xf3, 0xf3, 0xf1, 0xf7, 0xf8, 0xfa, 0x02, 0xfe, 0xf3, 0xed, 0xf2, 0xfc, 0x03, 0x09, 0xff, 0xfa, 
-  0xfa, 0xff, 0x06, 0x0f, 0x0d, 0xff, 0xe8, 0xd4, 0xde, 0xe1, 0xdd, 0xe0, 0xe9, 0xe2, 0xdd, 0xd8, 
-  0xd7, 0xe0, 0xe8, 0xf2, 0xf7, 0xf5, 0xf5, 0xfe, 0x05, 0x0e, 0x0c, 0xfd, 0xf5, 0xf1, 0xf6, 0xf2, 
-  0xe2, 0xd2, 0xc1, 0xc6, 0xd1, 0xd9, 0xe3, 0xed, 0xf5, 0xfa, 0xf4, 0xf5, 0x00, 0x07, 0x05, 0xfc, 
-  0xfe, 0xfa, 0xf1, 0xf7, 0xff, 0xf9, 0xf7, 0xff, 0x04, 0xff, 0xe7, 0xcd, 0xc3, 0xb4, 0xae, 0xb3, 
-  0xab, 0xa6, 0xab, 0xb3, 0xba, 0xb5, 0xb6, 0xc1, 0xcb, 0xd4, 0xdb, 0xe4, 0xed, 0xf4, 0xfe, 0x02, 
-  0xfa, 0xfe, 0xfe, 0xfd, 0x02, 0xf7, 0xd3, 0xca, 0xc6, 0xba, 0xc3, 0xc8, 0xcf, 0xce, 0xd1, 0xd5, 
-  0xd0, 0xd0, 0xd8, 0xdb, 0xd5, 0xcf, 0xd3, 0xdb, 0xe3, 0xeb, 0xea, 0xe7, 0xef, 0xf9, 0x03, 0x07, 
-  0xfb, 0xea, 0xea, 0xe9, 0xda, 0xe2, 0xe9, 0xe9, 0xeb, 0xf3, 0xec, 0xd9, 0xd9, 0xe2, 0xec, 0xf5, 
-  0xf9, 0xf8, 0xfa, 0x01, 0x06, 0xff, 0xff, 0x04, 0xfe, 0xf9, 0xf6, 0xe7, 0xd6, 0xd8, 0xdd, 0xd0, 
-  0xd2, 0xde, 0xe5, 0xee, 0xf6, 0xfe, 0xf7, 0xf9, 0x03, 0x0c, 0x13, 0x13, 0x14, 0x1b, 0x1e, 0x12, 
-  0x08, 0x0c, 0x13, 0x19, 0x1d, 0x14, 0xfe, 0xf2, 0xf5, 0xff, 0xf1, 0xe7, 0xe6, 0xdf, 0xe2, 0xe9, 
-  0xf1, 0xea, 0xe8, 0xf2, 0xfc, 0x05, 0x0b, 0x13, 0x1c, 0x26, 0x22, 0x1d, 0x26, 0x2e, 0x38, 0x3a, 
-  0x30, 0x1a, 0x10, 0x07, 0x08, 0x03, 0xf7, 0x00, 0x03, 0x04, 0x06, 0x0a, 0x03, 0x02, 0x0b, 0x11, 
-  0x0f, 0x09, 0x0b, 0x12, 0x17, 0x0f, 0x0f, 0x18, 0x21, 0x2a, 0x31, 0x2b, 0x16, 0x10, 0x16, 0x20, 
-  0x21, 0x12, 0x18, 0x20, 0x21, 0x24, 0x2b, 0x1d, 0x0f, 0x17, 0x1f, 0x28, 0x2c, 0x29, 0x2c, 0x2d, 
-  0x26, 0x2b, 0x34, 0x39, 0x36, 0x2e, 0x1e, 0x0a, 0x07, 0x0d, 0x16, 0x1b, 0x0d, 0x0d, 0x17, 0x1d, 
-  0x26, 0x2e, 0x29, 0x26, 0x30, 0x38, 0x40, 0x47, 0x4a, 0x4b, 0x46, 0x3f, 0x39, 0x3d, 0x45, 0x4c, 
-  0x4d, 0x39, 0x22, 0x1f, 0x29, 0x30, 0x38, 0x2a, 0x19, 0x0a, 0xf5, 0xee, 0xf0, 0xea, 0xe6, 0xee, 
-  0xf7, 0xff, 0x06, 0x0e, 0x13, 0x0c, 0x0b, 0x13, 0x1d, 0x24, 0x2a, 0x2f, 0x1c, 0x05, 0x00, 0x08, 
-  0x04, 0x03, 0xfe, 0xf1, 0xf5, 0xf6, 0xfa, 0x00, 0xfb, 0xf9, 0x01, 0x08, 0x0a, 0x05, 0x05, 0x02, 
-  0xfb, 0xfe, 0x06, 0x0d, 0x14, 0x10, 0xfc, 0xe9, 0xdc, 0xdd, 0xe7, 0xee, 0xf6, 0xf7, 0xe8, 0xec, 
-  0xf4, 0xf5, 0xf6, 0xf0, 0xe7, 0xe1, 0xe8, 0xf0, 0xf1, 0xf2, 0xec, 0xe6, 0xec, 0xf5, 0xfd, 0x04, 
-  0x07, 0xfa, 0xde, 0xce, 0xd2, 0xdc, 0xe3, 0xea, 0xee, 0xdf, 0xde, 0xe9, 0xef, 0xf6, 0xf0, 0xed, 
-  0xf5, 0xff, 0x06, 0x0d, 0x14, 0x09, 0xfa, 0xf6, 0xf8, 0xf4, 0xf6, 0x00, 0xf3, 0xd0, 0xbc, 0xbd, 
-  0xc2, 0xca, 0xd0, 0xd8, 0xca, 0xb8, 0xb9, 0xba, 0xc1, 0xbe, 0xb9, 0xbe, 0xc7, 0xce, 0xd7, 0xdb, 
-  0xd3, 0xd4, 0xdd, 0xe6, 0xed, 0xf3, 0xfd, 0xf5, 0xe1, 0xd7, 0xd8, 0xdb, 0xe4, 0xe3, 0xe3, 0xde, 
-  0xcc, 0xcd, 0xd2, 0xd9, 0xd4, 0xcf, 0xd6, 0xdc, 0xe1, 0xe0, 0xd3, 0xc8, 0xce, 0xd7, 0xdf, 0xe6, 
-  0xed, 0xf4, 0xec, 0xdb, 0xd5, 0xdd, 0xe5, 0xf0, 0xf6, 0xfd, 0xfe, 0xf0, 0xf2, 0xfa, 0xfc, 0xf3, 
-  0xea, 0xed, 0xeb, 0xf0, 0xf1, 0xe7, 0xe3, 0xea, 0xf2, 0xf9, 0x00, 0x06, 0x0b, 0xf9, 0xdb, 0xd2, 
-  0xd8, 0xe1, 0xe9, 0xf0, 0xf6, 0xfb, 0xed, 0xec, 0xf6, 0xfc, 0xfa, 0xf4, 0xfb, 0x01, 0x0b, 0x10, 
-  0x08, 0x08, 0x0e, 0x10, 0x13, 0x1a, 0x1a, 0x16, 0x05, 0xec, 0xea, 0xf1, 0xfa, 0x00, 0x08, 0x0c, 
-  0x14, 0x04, 0xf0, 0xf2, 0xf7, 0xf7, 0xf0, 0xf5, 0xfb, 0x01, 0xff, 0xfb, 0x00, 0x09, 0x10, 0x18, 
-  0x22, 0x29, 0x2c, 0x1e, 0x0d, 0x0e, 0x14, 0x18, 0x19, 0x20, 0x21, 0x21, 0x17, 0x05, 0x09, 0x0f, 
-  0x0d, 0x05, 0x08, 0x0e, 0x14, 0x0c, 0xfe, 0xfe, 0x03, 0x0c, 0x15, 0x1c, 0x22, 0x22, 0x11, 0x03, 
-  0x06, 0x0d, 0x15, 0x1b, 0x24, 0x2b, 0x34, 0x36, 0x26, 0x28, 0x33, 0x2d, 0x20, 0x20, 0x28, 0x22, 
-  0x13, 0x0f, 0x16, 0x1d, 0x24, 0x2b, 0x30, 0x35, 0x34, 0x1e, 0x08, 0x03, 0x08, 0x11, 0x19, 0x21, 
-  0x28, 0x2d, 0x33, 0x26, 0x21, 0x2c, 0x2b, 0x24, 0x26, 0x30, 0x30, 0x28, 0x2b, 0x33, 0x3b, 0x40, 
-  0x43, 0x46, 0x4d, 0x45, 0x26, 0x17, 0x19, 0x22, 0x29, 0x2f, 0x35, 0x3d, 0x42, 0x46, 0x29, 0x02, 
-  0xfc, 0xf9, 0xf1, 0xf1, 0xf9, 0xf3, 0xec, 0xf0, 0xf8, 0xff, 0x06, 0x0d, 0x14, 0x1c, 0x17, 0x02, 
-  0xf8, 0xfd, 0x06, 0x0b, 0x0d, 0x0f, 0x17, 0x19, 0x14, 0x0c, 0xfe, 0x03, 0x06, 0xfd, 0xfe, 0x02, 
-  0xfb, 0xf8, 0xf9, 0xf8, 0xfb, 0x02, 0x09, 0x10, 0x16, 0x0e, 0xf8, 0xef, 0xf3, 0xe7, 0xe0, 0xea, 
-  0xf0, 0xf8, 0x00, 0x07, 0x0a, 0xfb, 0xfb, 0xff, 0xf3, 0xee, 0xee, 0xe5, 0xd9, 0xd9, 0xe1, 0xe7, 
-  0xed, 0xf5, 0xfb, 0x00, 0xf8, 0xe1, 0xd6, 0xd5, 0xd8, 0xde, 0xe5, 0xee, 0xf6, 0xfc, 0x00, 0x06, 
-  0xf9, 0xf2, 0xf8, 0xf0, 0xf0, 0xef, 0xe9, 0xec, 0xf4, 0xfc, 0x02, 0x08, 0x0f, 0x0d, 0x06, 0xf3, 
-  0xce, 0xb7, 0xba, 0xc2, 0xc9, 0xce, 0xd4, 0xd9, 0xdf, 0xe3, 0xe7, 0xd8, 0xc7, 0xcd, 0xc5, 0xc2, 
-  0xbe, 0xb9, 0xbe, 0xc2, 0xc9, 0xd0, 0xd7, 0xdf, 0xe5, 0xeb, 0xe1, 0xcd, 0xc8, 0xd1, 0xd7, 0xde, 
-  0xe4, 0xe9, 0xeb, 0xf0, 0xf2, 0xf3, 0xee, 0xe0, 0xe2, 0xdd, 0xd6, 0xcd, 0xc8, 0xcf, 0xd1, 0xd2, 
-  0xd2, 0xd7, 0xde, 0xe6, 0xeb, 0xde, 0xca, 0xc8, 0xd0, 0xd7, 0xdf, 0xe7, 0xef, 0xf6, 0xff, 0x07, 
-  0x0e, 0x11, 0x01, 0xfd, 0xfa, 0xed, 0xe0, 0xdb, 0xdf, 0xdf, 0xe0, 0xe7, 0xef, 0xf5, 0xfc, 0x00, 
-  0xf1, 0xde, 0xda, 0xdc, 0xdf, 0xe5, 0xeb, 0xf2, 0xf9, 0x00, 0x07, 0x0c, 0x13, 0x05, 0xfc, 0xfc, 
-  0xee, 0xe6, 0xea, 0xf2, 0xf7, 0xfd, 0x03, 0x0a, 0x12, 0x17, 0x18, 0x03, 0xee, 0xeb, 0xec, 0xf3, 
-  0xfa, 0x01, 0x07, 0x0e, 0x14, 0x1b, 0x1e, 0x21, 0x14, 0x03, 0x00, 0xee, 0xe6, 0xeb, 0xf1, 0xf7, 
-  0xfb, 0x01, 0x09, 0x11, 0x18, 0x1c, 0x0d, 0xfe, 0xfe, 0x05, 0x0e, 0x16, 0x1d, 0x23, 0x28, 0x27, 
-  0x2b, 0x2f, 0x32, 0x2c, 0x1b, 0x12, 0xfd, 0xf7, 0xfc, 0x01, 0x06, 0x07, 0x09, 0x0d, 0x14, 0x1c, 
-  0x1e, 0x0d, 0xfe, 0xff, 0x05, 0x0c, 0x13, 0x1b, 0x21, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x47, 0x38, 
-  0x2a, 0x16, 0x0f, 0x11, 0x12, 0x17, 0x1a, 0x1c, 0x22, 0x28, 0x2e, 0x2e, 0x1c, 0x0d, 0x0d, 0x0f, 
-  0x11, 0x15, 0x1b, 0x22, 0x29, 0x2f, 0x36, 0x3e, 0x44, 0x48, 0x3b, 0x24, 0x13, 0x10, 0x18, 0x1e, 
-  0x24, 0x2a, 0x31, 0x38, 0x3e, 0x43, 0x42, 0x2b, 0x1a, 0x1b, 0x20, 0x24, 0x29, 0x2f, 0x34, 0x39, 
-  0x3f, 0x45, 0x4b, 0x40, 0x2d, 0x18, 0xf4, 0xe0, 0xdf, 0xe5, 0xea, 0xef, 0xf4, 0xf9, 0xff, 0x06, 
-  0x0c, 0x0b, 0xf9, 0xec, 0xef, 0xf6, 0xfe, 0x05, 0x0b, 0x10, 0x16, 0x19, 0x19, 0x1f, 0x24, 0x27, 
-  0x20, 0xfe, 0xe9, 0xea, 0xee, 0xf4, 0xf9, 0xfc, 0xfc, 0x01, 0x07, 0x0d, 0x0a, 0xf7, 0xeb, 0xf0, 
-  0xf5, 0xfb, 0x01, 0x08, 0x05, 0xf7, 0xfa, 0x03, 0x09, 0x10, 0x16, 0x15, 0xf5, 0xdd, 0xdc, 0xdd, 
-  0xe1, 0xe3, 0xe8, 0xec, 0xee, 0xf2, 0xf7, 0xf3, 0xe0, 0xd5, 0xd7, 0xdc, 0xde, 0xe1, 0xe8, 0xee, 
-  0xf4, 0xfb, 0x01, 0x09, 0x0f, 0x13, 0x12, 0xf7, 0xde, 0xdd, 0xe1, 0xe8, 0xed, 0xf4, 0xfa, 0x02, 
-  0x09, 0x0e, 0x05, 0xe7, 0xce, 0xc4, 0xc3, 0xc8, 0xc9, 0xce, 0xd4, 0xdb, 0xe0, 0xe6, 0xea, 0xee, 
-  0xed, 0xe7, 0xd4, 0xb9, 0xb4, 0xba, 0xbf, 0xc5, 0xca, 0xcf, 0xd6, 0xdb, 0xe1, 0xdd, 0xc9, 0xc0, 
-  0xc3, 0xca, 0xd1, 0xd6, 0xde, 0xe3, 0xe8, 0xec, 0xf2, 0xf7, 0xfc, 0x00, 0xf8, 0xeb, 0xcf, 0xc5, 
-  0xcb, 0xcf, 0xd5, 0xd9, 0xdc, 0xdd, 0xe2, 0xe8, 0xe2, 0xce, 0xc5, 0xca, 0xd1, 0xd7, 0xde, 0xe4, 
-  0xe9, 0xf1, 0xf8, 0x01, 0x07, 0x0d, 0x11, 0x0a, 0x07, 0xef, 0xdb, 0xdc, 0xe0, 0xe5, 0xe8, 0xef, 
-  0xf4, 0xf6, 0xfa, 0xf4, 0xe0, 0xd6, 0xda, 0xe0, 0xe5, 0xe6, 0xeb, 0xf3, 0xf9, 0xff, 0x06, 0x0d, 
-  0x12, 0x13, 0x0a, 0x0c, 0xfa, 0xe2, 0xe6, 0xec, 0xf3, 0xf7, 0xfe, 0x04, 0x09, 0x10, 0x08, 0xf1, 
-  0xe8, 0xeb, 0xf1, 0xf7, 0xfc, 0xff, 0x04, 0x0a, 0x10, 0x16, 0x1d, 0x20, 0x1c, 0x10, 0x13, 0x0a, 
-  0xee, 0xec, 0xf2, 0xf9, 0xfe, 0x04, 0x0a, 0x0f, 0x13, 0x0c, 0xf9, 0xf0, 0xf4, 0xfc, 0x04, 0x0b, 
-  0x11, 0x17, 0x1c, 0x20, 0x25, 0x2c, 0x2f, 0x2a, 0x24, 0x27, 0x21, 0x03, 0xfa, 0x01, 0x06, 0x0b, 
-  0x0e, 0x11, 0x15, 0x1a, 0x14, 0x00, 0xf6, 0xfb, 0x02, 0x09, 0x10, 0x14, 0x1a, 0x20, 0x27, 0x2d, 
-  0x34, 0x38, 0x33, 0x30, 0x35, 0x38, 0x1d, 0x0b, 0x12, 0x17, 0x1c, 0x1e, 0x24, 0x28, 0x2a, 0x21, 
-  0x0f, 0x05, 0x07, 0x0e, 0x13, 0x15, 0x18, 0x1e, 0x25, 0x2c, 0x33, 0x39, 0x3c, 0x35, 0x35, 0x38, 
-  0x3f, 0x2b, 0x13, 0x1a, 0x1f, 0x26, 0x2b, 0x30, 0x35, 0x39, 0x31, 0x1b, 0x11, 0x15, 0x1d, 0x23, 
-  0x28, 0x2e, 0x32, 0x36, 0x3c, 0x42, 0x47, 0x45, 0x34, 0x20, 0x14, 0x15, 0x08, 0xed, 0xee, 0xf4, 
-  0xf9, 0xfd, 0x02, 0x07, 0x0a, 0x02, 0xee, 0xe3, 0xe6, 0xed, 0xf5, 0xfc, 0x03, 0x08, 0x0c, 0x11, 
-  0x17, 0x1c, 0x1a, 0x13, 0x14, 0x19, 0x1f, 0x18, 0xf9, 0xf5, 0xfb, 0x00, 0x04, 0x06, 0x09, 0x0c, 
-  0x06, 0xf3, 0xe9, 0xeb, 0xf3, 0xf9, 0x00, 0x06, 0x0b, 0x11, 0x16, 0x1b, 0x0f, 0xfb, 0xf8, 0xfd, 
-  0x02, 0x07, 0x05, 0xea, 0xdd, 0xe4, 0xe9, 0xee, 0xf1, 0xf5, 0xf9, 0xf0, 0xda, 0xcf, 0xd2, 0xd9, 
-  0xdf, 0xe3, 0xe6, 0xea, 0xf0, 0xf8, 0xff, 0x02, 0xfd, 0xfb, 0x00, 0x06, 0x0a, 0x0e, 0xf8, 0xe2, 
-  0xe8, 0xee, 0xf4, 0xf9, 0xff, 0x01, 0xf0, 0xd3, 0xc7, 0xca, 0xd0, 0xd5, 0xd2, 0xd0, 0xd3, 0xd7, 
-  0xdb, 0xe1, 0xe3, 0xdc, 0xdb, 0xdd, 0xe0, 0xe3, 0xe7, 0xdb, 0xc2, 0xc3, 0xca, 0xcf, 0xd4, 0xda, 
-  0xde, 0xd6, 0xc4, 0xb9, 0xbb, 0xc2, 0xc9, 0xcf, 0xd5, 0xda, 0xde, 0xe2, 0xea, 0xeb, 0xe4, 0xe5, 
-  0xe9, 0xed, 0xf2, 0xf9, 0xf0, 0xd4, 0xd0, 0xd8, 0xdc, 0xe0, 0xe3, 0xe6, 0xdd, 0xcc, 0xc3, 0xc5, 
-  0xcb, 0xd2, 0xd9, 0xe0, 0xe5, 0xea, 0xf0, 0xf6, 0xf5, 0xf0, 0xf3, 0xfa, 0x00, 0x06, 0x09, 0x05, 
-  0xec, 0xe0, 0xe7, 0xec, 0xf2, 0xf5, 0xf9, 0xf2, 0xdf, 0xd1, 0xd3, 0xd9, 0xe1, 0xe7, 0xeb, 0xee, 
-  0xf4, 0xfa, 0x02, 0xff, 0xf9, 0xfc, 0x02, 0x09, 0x0e, 0x13, 0x15, 0x00, 0xec, 0xf2, 0xf8, 0xff, 
-  0x03, 0x07, 0x00, 0xee, 0xe3, 0xe5, 0xeb, 0xf2, 0xf8, 0xfc, 0x02, 0x08, 0x0c, 0x10, 0x0b, 0x06, 
-  0x09, 0x0e, 0x13, 0x16, 0x1a, 0x1e, 0x11, 0xfa, 0xfb, 0x02, 0x08, 0x0d, 0x11, 0x0c, 0xfa, 0xef, 
-  0xef, 0xf4, 0xfb, 0x02, 0x09, 0x0e, 0x13, 0x17, 0x1b, 0x16, 0x14, 0x18, 0x1e, 0x23, 0x27, 0x2b, 
-  0x2e, 0x24, 0x0a, 0x05, 0x0d, 0x12, 0x16, 0x18, 0x13, 0x02, 0xf7, 0xf8, 0xfe, 0x04, 0x0b, 0x11, 
-  0x17, 0x1d, 0x22, 0x24, 0x1e, 0x1c, 0x20, 0x26, 0x2e, 0x32, 0x36, 0x39, 0x35, 0x1e, 0x13, 0x1b, 
-  0x21, 0x26, 0x29, 0x25, 0x14, 0x07, 0x04, 0x0a, 0x10, 0x16, 0x19, 0x1d, 0x21, 0x27, 0x28, 0x22, 
-  0x22, 0x26, 0x2c, 0x34, 0x38, 0x3e, 0x43, 0x42, 0x30, 0x1e, 0x23, 0x2a, 0x30, 0x34, 0x2f, 0x1e, 
-  0x11, 0x10, 0x16, 0x1c, 0x23, 0x29, 0x2d, 0x32, 0x37, 0x35, 0x2e, 0x2f, 0x32, 0x30, 0x23, 0x16, 
-  0x14, 0x19, 0x1a, 0x0d, 0xf9, 0xf9, 0x00, 0x05, 0x0a, 0x06, 0xf7, 0xe9, 0xe8, 0xeb, 0xef, 0xf5, 
-  0xfb, 0x00, 0x04, 0x09, 0x05, 0xff, 0x01, 0x06, 0x0d, 0x12, 0x17, 0x1b, 0x20, 0x21, 0x18, 0x02, 
-  0xfd, 0x05, 0x07, 0x0b, 0x07, 0xfb, 0xee, 0xec, 0xf1, 0xf7, 0xfc, 0x01, 0x07, 0x0d, 0x12, 0x0c, 
-  0x07, 0x0a, 0x0e, 0x0d, 0xfd, 0xfb, 0x01, 0x05, 0x06, 0x01, 0xef, 0xe5, 0xec, 0xf1, 0xf6, 0xf3, 
-  0xe6, 0xd8, 0xd6, 0xd8, 0xde, 0xe3, 0xe8, 0xec, 0xf4, 0xf7, 0xf8, 0xf7, 0xef, 0x07, 0x12, 0x0a, 
-  0x25, 0x36, 0x1c, 0xe7, 0xe6, 0xfe, 0xd5, 0xdf, 0xe5, 0xcd, 0xde, 0xd3, 0xbb, 0xc0, 0xd7, 0xca, 
-  0xcf, 0xf0, 0xf1, 0xe3, 0xd5, 0xed, 0xf3, 0xd7, 0xd9, 0xfa, 0x0d, 0xfb, 0xf9, 0x15, 0x18, 0x17, 
-  0x12, 0xfa, 0x0a, 0x16, 0x11, 0x17, 0x05, 0xca, 0xab, 0xba, 0xc1, 0xbf, 0xcb, 0xde, 0xdb, 0xdd, 
-  0xe1, 0xdc, 0xe9, 0xe9, 0xf1, 0x03, 0x04, 0x0e, 0x18, 0x1b, 0x19, 0x1c, 0x0e, 0x0f, 0x15, 0x12, 
-  0x14, 0x13, 0x14, 0x17, 0x16, 0x02, 0x0e, 0x23, 0x2b, 0x32, 0x28, 0xfd, 0xce, 0xcf, 0xe4, 0xf0, 
-  0xf2, 0xfb, 0x04, 0x08, 0x0d, 0x11, 0x16, 0x09, 0x02, 0x0c, 0x15, 0x19, 0x12, 0x03, 0xf6, 0xfb, 
-  0x03, 0x0a, 0x13, 0x16, 0x1f, 0x25, 0x27, 0x2c, 0x30, 0x2e, 0x34, 0x3d, 0x48, 0x49, 0x3b, 0x2a, 
-  0x12, 0x10, 0x0c, 0x03, 0x0b, 0x14, 0x1c, 0x17, 0x12, 0x10, 0x14, 0x21, 0x29, 0x33, 0x3e, 0x46, 
-  0x42, 0x33, 0x35, 0x3f, 0x45, 0x4c, 0x56, 0x57, 0x64, 0x78, 0x75, 0x78, 0x7f, 0x6d, 0x5a, 0x54, 
-  0x4b, 0x30, 0x0c, 0xe5, 0xb8, 0xb0, 0xb9, 0xc0, 0xc9, 0xd3, 0xdb, 0xd7, 0xd7, 0xdd, 0xe3, 0xec, 
-  0xf5, 0xfb, 0x01, 0x0a, 0x07, 0xff, 0x04, 0x07, 0x05, 0xfa, 0xf8, 0x01, 0x05, 0x03, 0xfd, 0xfb, 
-  0xf8, 0xf0, 0xf5, 0xff, 0x04, 0xff, 0xe5, 0xd7, 0xce, 0xc1, 0xc8, 0xd1, 0xd7, 0xdc, 0xe5, 0xee, 
-  0xf6, 0xfe, 0x01, 0x02, 0xfc, 0xf8, 0x01, 0x05, 0xf5, 0xe7, 0xe5, 0xe9, 0xef, 0xf6, 0xfc, 0x04, 
-  0x0a, 0x0b, 0x0c, 0x13, 0x15, 0x0d, 0x0f, 0x17, 0x20, 0x1a, 0x0b, 0x01, 0x05, 0xf6, 0xf2, 0xf4, 
-  0xe3, 0xeb, 0xf6, 0xfc, 0xf8, 0xee, 0xef, 0xf9, 0x0c, 0x08, 0xfc, 0xf7, 0xec, 0xf0, 0xf4, 0x00, 
-  0x04, 0x08, 0x0e, 0x0a, 0x07, 0x0a, 0x07, 0x03, 0x03, 0xf5, 0xef, 0xeb, 0xed, 0xe3, 0xcb, 0xbe, 
-  0xbb, 0xad, 0xa4, 0xa8, 0xb3, 0xc1, 0xbc, 0xc0, 0xcc, 0xcb, 0xd0, 0xe2, 0xe9, 0xec, 0xf4, 0xf1, 
-  0xee, 0xfb, 0x05, 0x05, 0x0a, 0x14, 0x09, 0x06, 0x0f, 0x12, 0x10, 0x0e, 0x0a, 0x04, 0x03, 0x0a, 
-  0x15, 0x08, 0xf0, 0xe7, 0xf4, 0xf1, 0xe6, 0xec, 0xec, 0xf6, 0x03, 0xfd, 0xf8, 0x05, 0x0d, 0x10, 
-  0x13, 0x12, 0x07, 0xff, 0xfe, 0xfe, 0xfc, 0xfc, 0x00, 0x07, 0x0f, 0x14, 0x17, 0x17, 0x18, 0x21, 
-  0x23, 0x1d, 0x20, 0x24, 0x21, 0x18, 0x0c, 0x08, 0x12, 0x17, 0x06, 0xfb, 0xf7, 0xe9, 0xee, 0xee, 
-  0xe9, 0xed, 0xeb, 0xef, 0xf6, 0xfd, 0xf6, 0xef, 0xf0, 0xf3, 0xf7, 0xf3, 0xfa, 0x02, 0x06, 0x0b, 
-  0x12, 0x16, 0x1c, 0x29, 0x2a, 0x20, 0x1b, 0x1d, 0x0d, 0xf9, 0xec, 0xe5, 0xe2, 0xe4, 0xdc, 0xcd, 
-  0xd7, 0xdc, 0xdd, 0xde, 0xe2, 0xeb, 0xf0, 0xf8, 0x01, 0x01, 0xf9, 0xfb, 0x04, 0x0d, 0x15, 0x1c, 
-  0x20, 0x26, 0x26, 0x23, 0x23, 0x28, 0x27, 0x24, 0x22, 0x18, 0x17, 0x21, 0x19, 0x08, 0xfb, 0xf6, 
-  0x01, 0x0a, 0x0d, 0xfc, 0xf8, 0x01, 0x09, 0x15, 0x1a, 0x21, 0x28, 0x2e, 0x37, 0x32, 0x1f, 0x1b, 
-  0x21, 0x22, 0x21, 0x21, 0x25, 0x2c, 0x31, 0x3a, 0x3c, 0x3b, 0x3f, 0x49, 0x4c, 0x37, 0x24, 0x19, 
-  0x08, 0xfd, 0xf6, 0xf6, 0xff, 0x05, 0x08, 0xe4, 0xcc, 0xd2, 0xca, 0xcb, 0xca, 0xcb, 0xc9, 0xcc, 
-  0xd0, 0xc9, 0xc8, 0xc9, 0xca, 0xd1, 0xd9, 0xde, 0xe5, 0xec, 0xf1, 0xf7, 0xfe, 0x03, 0x09, 0x12, 
-  0x16, 0x0d, 0x0e, 0x10, 0xff, 0xe8, 0xdc, 0xd8, 0xd9, 0xd9, 0xde, 0xda, 0xcb, 0xcd, 0xce, 0xd0, 
-  0xd7, 0xdf, 0xe4, 0xea, 0xea, 0xe4, 0xe7, 0xee, 0xf4, 0xfa, 0x04, 0x09, 0x11, 0x16, 0x1a, 0x20, 
-  0x1a, 0x15, 0x18, 0x19, 0x19, 0x0c, 0x0b, 0x0e, 0x01, 0xf3, 0xe8, 0xe9, 0xf1, 0xfb, 0x03, 0x04, 
-  0xf5, 0xf2, 0xfa, 0xfe, 0x06, 0x00, 0xf9, 0xff, 0xfb, 0xf5, 0xf6, 0xf4, 0xf3, 0xf4, 0xf7, 0xf5, 
-  0xf7, 0xfd, 0x02, 0x08, 0x08, 0x07, 0x01, 0xfd, 0x03, 0xf9, 0xf8, 0xf9, 0xeb, 0xe2, 0xdb, 0xde, 
-  0xe6, 0xef, 0xf5, 0xfe, 0xf4, 0xe2, 0xe4, 0xe1, 0xe0, 0xe0, 0xe1, 0xde, 0xd5, 0xd7, 0xdb, 0xdc, 
-  0xdf, 0xe5, 0xed, 0xf4, 0xfb, 0x01, 0x07, 0x0b, 0x0c, 0x0a, 0x0b, 0x10, 0x15, 0x0f, 0x0c, 0x0c, 
-  0xf9, 0xeb, 0xde, 0xda, 0xdb, 0xdc, 0xdd, 0xe4, 0xe4, 0xd0, 0xcd, 0xd1, 0xd4, 0xdc, 0xe3, 0xdf, 
-  0xd6, 0xdd, 0xe5, 0xea, 0xef, 0xf7, 0xfe, 0x05, 0x0d, 0x13, 0x1a, 0x1e, 0x20, 0x1f, 0x1b, 0x1a, 
-  0x19, 0x0f, 0x09, 0x04, 0xf6, 0xe9, 0xe0, 0xe7, 0xee, 0xf5, 0xfc, 0x00, 0x04, 0xf9, 0xf1, 0xfb, 
-  0xfe, 0x04, 0x08, 0xf8, 0xf2, 0xfd, 0x00, 0x03, 0x05, 0x01, 0x00, 0x01, 0x05, 0x08, 0x0e, 0x11, 
-  0x11, 0x14, 0x1c, 0x21, 0x27, 0x21, 0x1c, 0x17, 0x0c, 0x03, 0xfc, 0x03, 0x0b, 0x11, 0x18, 0x1c, 
-  0x21, 0x1b, 0x07, 0x0a, 0x08, 0x05, 0x00, 0xf3, 0xf4, 0xfb, 0xff, 0x02, 0x08, 0x0e, 0x15, 0x1d, 
-  0x23, 0x25, 0x28, 0x2d, 0x34, 0x38, 0x3f, 0x43, 0x4b, 0x48, 0x42, 0x3c, 0x31, 0x25, 0x1c, 0x19, 
-  0x17, 0x1a, 0x1c, 0x22, 0x28, 0x28, 0x13, 0x0f, 0x1a, 0x1d, 0x17, 0x12, 0x17, 0x1e, 0x25, 0x2a, 
-  0x32, 0x38, 0x3c, 0x42, 0x4c, 0x53, 0x5a, 0x5e, 0x62, 0x64, 0x65, 0x56, 0x44, 0x30, 0x17, 0x0a, 
-  0xfc, 0xf1, 0xe9, 0xef, 0xf3, 0xfa, 0x00, 0x06, 0x0a, 0x10, 0xfc, 0xd7, 0xdc, 0xdf, 0xd4, 0xd2, 
-  0xd9, 0xde, 0xe4, 0xe8, 0xec, 0xed, 0xe5, 0xe5, 0xe8, 0xeb, 0xee, 0xf2, 0xf4, 0xf7, 0xfd, 0x03, 
-  0x08, 0x05, 0xfc, 0xee, 0xe5, 0xdf, 0xd7, 0xdc, 0xe1, 0xe7, 0xed, 0xf4, 0xf9, 0xfe, 0xfc, 0xe7, 
-  0xe6, 0xdb, 0xc8, 0xc7, 0xcb, 0xcf, 0xcf, 0xd2, 0xd8, 0xdf, 0xe3, 0xea, 0xef, 0xf3, 0xf9, 0xfe, 
-  0x02, 0x06, 0x0c, 0x12, 0x16, 0x15, 0x0b, 0xfd, 0xf5, 0xee, 0xe5, 0xe6, 0xe4, 0xe2, 0xe5, 0xe6, 
-  0xec, 0xe6, 0xda, 0xc7, 0xc0, 0xbe, 0xb4, 0xb9, 0xc0, 0xc3, 0xc6, 0xce, 0xd4, 0xd9, 0xde, 0xe3, 
-  0xe8, 0xf0, 0xf6, 0xfa, 0x01, 0x02, 0xf8, 0xec, 0xe8, 0xe6, 0xda, 0xc6, 0xbc, 0xb3, 0xad, 0xb5, 
-  0xbc, 0xc0, 0xc5, 0xca, 0xd1, 0xd6, 0xde, 0xd9, 0xc4, 0xbc, 0xbb, 0xc0, 0xc6, 0xcb, 0xd1, 0xd8, 
-  0xdd, 0xe2, 0xe2, 0xdf, 0xe0, 0xe4, 0xe9, 0xed, 0xf1, 0xf6, 0xfd, 0x03, 0x07, 0x08, 0xff, 0xec, 
-  0xe4, 0xdd, 0xdc, 0xe1, 0xe5, 0xea, 0xf1, 0xfa, 0x00, 0x08, 0x10, 0x13, 0xf7, 0xe2, 0xe1, 0xe0, 
-  0xe5, 0xe7, 0xe9, 0xef, 0xf7, 0xfd, 0x03, 0x0a, 0x10, 0x15, 0x1c, 0x22, 0x28, 0x29, 0x2a, 0x2d, 
-  0x31, 0x34, 0x2b, 0x18, 0x11, 0x09, 0x06, 0x09, 0x09, 0x09, 0x08, 0x0c, 0x0f, 0x14, 0x18, 0x1f, 
-  0x09, 0xf3, 0xfb, 0xff, 0x04, 0x08, 0x0c, 0x11, 0x17, 0x1e, 0x24, 0x2b, 0x31, 0x35, 0x3d, 0x44, 
-  0x4a, 0x50, 0x51, 0x52, 0x53, 0x50, 0x42, 0x28, 0x1e, 0x16, 0x12, 0x19, 0x1e, 0x23, 0x27, 0x2d, 
-  0x33, 0x38, 0x3c, 0x41, 0x31, 0x16, 0x19, 0x21, 0x25, 0x2a, 0x2b, 0x2d, 0x31, 0x36, 0x38, 0x3a, 
-  0x38, 0x38, 0x3a, 0x3e, 0x41, 0x47, 0x49, 0x4e, 0x54, 0x57, 0x4c, 0x34, 0x2d, 0x24, 0x20, 0x25, 
-  0x29, 0x2d, 0x2f, 0x33, 0x39, 0x3e, 0x45, 0x44, 0x3b, 0x22, 0x17, 0x19, 0x17, 0x18, 0x18, 0x1c, 
-  0x22, 0x29, 0x2f, 0x35, 0x39, 0x3d, 0x41, 0x47, 0x49, 0x4c, 0x45, 0x37, 0x32, 0x2a, 0x18, 0xfe, 
-  0xf7, 0xf0, 0xeb, 0xef, 0xee, 0xef, 0xee, 0xea, 0xea, 0xed, 0xf1, 0xec, 0xe6, 0xdd, 0xbf, 0xaf, 
-  0xb2, 0xb7, 0xba, 0xbd, 0xc0, 0xc7, 0xcb, 0xd0, 0xd6, 0xdb, 0xde, 0xe4, 0xea, 0xf0, 0xf4, 0xf4, 
-  0xf3, 0xf4, 0xe6, 0xc7, 0xbc, 0xb7, 0xb3, 0xb6, 0xbc, 0xc2, 0xc7, 0xc8, 0xcd, 0xd6, 0xd8, 0xcf, 
-  0xcd, 0xce, 0xbb, 0xba, 0xc1, 0xc4, 0xcb, 0xd0, 0xd5, 0xdb, 0xe0, 0xe0, 0xe3, 0xe4, 0xe3, 0xe5, 
-  0xea, 0xf1, 0xf8, 0xfb, 0xfd, 0x04, 0xfe, 0xe4, 0xdc, 0xd7, 0xd1, 0xd5, 0xdb, 0xe2, 0xde, 0xd7, 
-  0xd6, 0xdd, 0xdd, 0xd7, 0xd6, 0xdc, 0xcc, 0xbe, 0xbf, 0xbd, 0xc0, 0xc5, 0xca, 0xd0, 0xd7, 0xdd, 
-  0xe2, 0xe9, 0xed, 0xf2, 0xf7, 0xfc, 0xfc, 0xf4, 0xf1, 0xf6, 0xf3, 0xdc, 0xd0, 0xca, 0xc5, 0xca, 
-  0xcf, 0xd3, 0xd3, 0xd4, 0xd1, 0xd5, 0xd1, 0xcc, 0xce, 0xd6, 0xd4, 0xc2, 0xc5, 0xcb, 0xcf, 0xd5, 
-  0xd7, 0xdc, 0xe3, 0xe9, 0xee, 0xf5, 0xfa, 0xfd, 0x03, 0x09, 0x10, 0x15, 0x14, 0x15, 0x11, 0xf4, 
-  0xe4, 0xde, 0xda, 0xdf, 0xe6, 0xed, 0xf1, 0xf8, 0xfd, 0xff, 0xf9, 0xf5, 0xfa, 0xff, 0x04, 0xf5, 
-  0xef, 0xf6, 0xf8, 0xfd, 0x02, 0x08, 0x0c, 0x11, 0x12, 0x13, 0x12, 0x14, 0x1a, 0x20, 0x26, 0x2c, 
-  0x30, 0x33, 0x31, 0x1a, 0x0d, 0x07, 0x01, 0x03, 0x09, 0x10, 0x14, 0x19, 0x1d, 0x1d, 0x15, 0x14, 
-  0x1b, 0x20, 0x25, 0x17, 0x05, 0x07, 0x08, 0x0c, 0x11, 0x17, 0x1b, 0x1f, 0x25, 0x2a, 0x2e, 0x33, 
-  0x38, 0x3c, 0x3f, 0x44, 0x47, 0x48, 0x46, 0x30, 0x20, 0x19, 0x12, 0x14, 0x19, 0x1d, 0x1e, 0x1f, 
-  0x1f, 0x19, 0x12, 0x13, 0x19, 0x20, 0x26, 0x25, 0x13, 0x12, 0x16, 0x1a, 0x1f, 0x23, 0x27, 0x2b, 
-  0x2f, 0x33, 0x39, 0x3e, 0x42, 0x45, 0x4c, 0x52, 0x55, 0x54, 0x51, 0x39, 0x24, 0x1c, 0x16, 0x17, 
-  0x1d, 0x23, 0x27, 0x2b, 0x30, 0x2b, 0x23, 0x26, 0x2a, 0x31, 0x35, 0x3a, 0x2c, 0x22, 0x29, 0x2a, 
-  0x2f, 0x34, 0x35, 0x36, 0x36, 0x38, 0x3b, 0x3b, 0x3d, 0x40, 0x39, 0x2f, 0x2e, 0x27, 0x1c, 0x09, 
-  0xf6, 0xec, 0xe5, 0xe6, 0xe8, 0xec, 0xf0, 0xf4, 0xf5, 0xf0, 0xe9, 0xed, 0xf0, 0xf6, 0xf8, 0xfd, 
-  0xf3, 0xdf, 0xce, 0xbd, 0xc4, 0xc9, 0xcb, 0xd0, 0xd4, 0xd8, 0xdc, 0xe3, 0xe6, 0xea, 0xee, 0xf1, 
-  0xf4, 0xf9, 0xf7, 0xe8, 0xd6, 0xca, 0xc1, 0xc3, 0xc7, 0xcc, 0xcf, 0xd0, 0xce, 0xc4, 0xbe, 0xc2, 
-  0xc8, 0xcd, 0xd3, 0xd8, 0xda, 0xca, 0xc6, 0xcc, 0xce, 0xd5, 0xda, 0xde, 0xe2, 0xe6, 0xe9, 0xf0, 
-  0xf5, 0xf9, 0xff, 0x05, 0x08, 0x0b, 0x09, 0xf8, 0xe6, 0xd7, 0xce, 0xcd, 0xc9, 0xc6, 0xca, 0xcf, 
-  0xce, 0xc6, 0xc7, 0xca, 0xd0, 0xd5, 0xda, 0xdd, 0xe5, 0xda, 0xcb, 0xd2, 0xd5, 0xd9, 0xe0, 0xe4, 
-  0xe5, 0xe7, 0xea, 0xed, 0xf2, 0xf6, 0xfb, 0xfe, 0xf9, 0xf7, 0xf5, 0xe8, 0xdb, 0xce, 0xc2, 0xbf, 
-  0xc6, 0xcc, 0xd1, 0xd7, 0xd2, 0xca, 0xcc, 0xd1, 0xd7, 0xda, 0xde, 0xe1, 0xe6, 0xe3, 0xd0, 0xcf, 
-  0xd4, 0xd9, 0xdf, 0xe5, 0xe8, 0xeb, 0xee, 0xf4, 0xfa, 0xfe, 0x03, 0x09, 0x0e, 0x13, 0x14, 0x09, 
-  0xfd, 0xf1, 0xe4, 0xe1, 0xe7, 0xeb, 0xef, 0xf2, 0xeb, 0xe2, 0xe4, 0xe9, 0xed, 0xf1, 0xf6, 0xfb, 
-  0x00, 0x06, 0xf8, 0xee, 0xf6, 0xf9, 0xff, 0x02, 0x04, 0x08, 0x0d, 0x12, 0x17, 0x1b, 0x1f, 0x24, 
-  0x2b, 0x2e, 0x2f, 0x23, 0x15, 0x09, 0xfa, 0xf4, 0xf9, 0x00, 0x06, 0x08, 0x03, 0x00, 0x03, 0x08, 
-  0x0b, 0x11, 0x14, 0x18, 0x1d, 0x25, 0x1e, 0x0d, 0x12, 0x16, 0x19, 0x1e, 0x1f, 0x21, 0x23, 0x26, 
-  0x2a, 0x2e, 0x31, 0x36, 0x3e, 0x42, 0x44, 0x3b, 0x31, 0x26, 0x16, 0x0f, 0x13, 0x18, 0x1c, 0x1d, 
-  0x17, 0x16, 0x18, 0x1d, 0x20, 0x23, 0x26, 0x2a, 0x2e, 0x32, 0x32, 0x1e, 0x1b, 0x22, 0x24, 0x29, 
-  0x2b, 0x2f, 0x32, 0x37, 0x3b, 0x40, 0x43, 0x46, 0x4a, 0x51, 0x52, 0x47, 0x3c, 0x35, 0x25, 0x1a, 
-  0x1c, 0x21, 0x24, 0x20, 0x18, 0x17, 0x1a, 0x1d, 0x20, 0x25, 0x2a, 0x2c, 0x32, 0x37, 0x3f, 0x32, 
-  0x22, 0x2b, 0x2f, 0x31, 0x32, 0x36, 0x3a, 0x3d, 0x40, 0x46, 0x42, 0x35, 0x33, 0x31, 0x29, 0x18, 
-  0x0a, 0x02, 0xf2, 0xe4, 0xe2, 0xe7, 0xec, 0xe7, 0xe0, 0xe2, 0xe7, 0xea, 0xee, 0xf1, 0xf6, 0xfb, 
-  0xff, 0x03, 0x08, 0x06, 0xf2, 0xf1, 0xe4, 0xd6, 0xdc, 0xdb, 0xdb, 0xdd, 0xe0, 0xe3, 0xe8, 0xea, 
-  0xf0, 0xf3, 0xf8, 0xf2, 0xe7, 0xe2, 0xd4, 0xc4, 0xc1, 0xc6, 0xcb, 0xc5, 0xbf, 0xc2, 0xc8, 0xcc, 
-  0xd0, 0xd4, 0xd6, 0xda, 0xdd, 0xe2, 0xe6, 0xe9, 0xd9, 0xd0, 0xd7, 0xda, 0xdd, 0xe0, 0xe5, 0xe9, 
-  0xee, 0xf3, 0xf9, 0xfd, 0x02, 0x06, 0x0a, 0x04, 0xfb, 0xf7, 0xe3, 0xc8, 0xc1, 0xc4, 0xc8, 0xc2, 
-  0xc0, 0xc2, 0xce, 0xd1, 0xca, 0xe3, 0xe4, 0xe0, 0xed, 0xdc, 0xce, 0xc0, 0xc8, 0xd1, 0xba, 0xcb, 
-  0xc8, 0xbe, 0xdd, 0xde, 0xd8, 0xea, 0xff, 0xec, 0xf6, 0x0d, 0x01, 0xe8, 0xd8, 0xfb, 0xf2, 0xc4, 
-  0xbf, 0xde, 0xe9, 0xcd, 0xcc, 0xe6, 0xe7, 0xf0, 0xe3, 0xbc, 0xc8, 0xcc, 0xb8, 0xc0, 0xd1, 0xd6, 
-  0xd5, 0xd1, 0xce, 0xcd, 0xd9, 0xe8, 0xe2, 0xec, 0xf7, 0xf8, 0x04, 0x01, 0x0d, 0x1a, 0x1b, 0x1e, 
-  0x1a, 0x16, 0x13, 0x0d, 0x03, 0x09, 0x06, 0xfa, 0xeb, 0xda, 0xd9, 0xe6, 0xd2, 0xba, 0xcb, 0xdb, 
-  0xe2, 0xed, 0xfd, 0x02, 0xf8, 0xeb, 0xf2, 0xf7, 0xef, 0xf6, 0xfd, 0x01, 0x04, 0x0c, 0x18, 0x1c, 
-  0x24, 0x2b, 0x33, 0x33, 0x2d, 0x2e, 0x30, 0x25, 0x09, 0xf6, 0xe0, 0xd2, 0xc9, 0xca, 0xd8, 0xdd, 
-  0xe5, 0xed, 0xf6, 0xfe, 0x0a, 0x12, 0x1b, 0x16, 0x0d, 0x0a, 0x00, 0x05, 0x0e, 0x14, 0x1e, 0x24, 
-  0x2f, 0x33, 0x3b, 0x47, 0x4e, 0x54, 0x5e, 0x5c, 0x41, 0x3a, 0x30, 0x15, 0xfc, 0xf5, 0xfa, 0xf3, 
-  0x02, 0x12, 0x0d, 0x15, 0x29, 0x30, 0x2e, 0x26, 0x1f, 0x1b, 0x25, 0x35, 0x39, 0x40, 0x38, 0x34, 
-  0x3f, 0x48, 0x4f, 0x52, 0x5c, 0x61, 0x67, 0x6a, 0x5e, 0x5b, 0x59, 0x42, 0x2f, 0x28, 0x2d, 0x2d, 
-  0x20, 0x1c, 0x18, 0x18, 0x1e, 0x27, 0x26, 0x1d, 0x15, 0x13, 0x1b, 0x22, 0x27, 0x2e, 0x34, 0x3c, 
-  0x44, 0x4d, 0x4a, 0x42, 0x49, 0x4f, 0x56, 0x54, 0x46, 0x45, 0x4d, 0x2f, 0x0b, 0x09, 0x0c, 0x0a, 
-  0xfc, 0xf2, 0xf7, 0xfb, 0xee, 0xe4, 0xd0, 0xc6, 0xbf, 0xbc, 0xc5, 0xca, 0xd2, 0xd7, 0xdf, 0xe6, 
-  0xef, 0xf7, 0xff, 0x03, 0x0d, 0x15, 0x21, 0x0d, 0xf3, 0xf3, 0xe9, 0xd8, 0xbc, 0xb7, 0xbd, 0xc8, 
-  0xd7, 0xd7, 0xd9, 0xde, 0xe0, 0xda, 0xcc, 0xd1, 0xbb, 0xa2, 0xa2, 0xa3, 0xae, 0xb6, 0xbb, 0xc4, 
-  0xd0, 0xd5, 0xdd, 0xe7, 0xf3, 0xf8, 0xff, 0x00, 0xf6, 0xfb, 0x07, 0xf2, 0xcf, 0xcf, 0xce, 0xda, 
-  0xe9, 0xe5, 0xec, 0xfa, 0x00, 0xfa, 0xf7, 0xfd, 0xf1, 0xdd, 0xd7, 0xd3, 0xd7, 0xd0, 0xc2, 0xc2, 
-  0xcc, 0xd7, 0xe1, 0xe7, 0xf0, 0xf9, 0xfc, 0xf7, 0xf4, 0xf9, 0xfd, 0x00, 0xeb, 0xd9, 0xec, 0xee, 
-  0xe0, 0xeb, 0xf8, 0xf9, 0xfe, 0xfd, 0xf7, 0xfe, 0xfc, 0xf8, 0xfd, 0x03, 0xfa, 0xed, 0xee, 0xf3, 
-  0xf5, 0xe9, 0xe0, 0xdf, 0xe6, 0xec, 0xf4, 0xee, 0xe1, 0xe8, 0xf1, 0xef, 0xdf, 0xd2, 0xd2, 0xda, 
-  0xe2, 0xe8, 0xef, 0xf8, 0xec, 0xdc, 0xdf, 0xe3, 0xe0, 0xe0, 0xe2, 0xe8, 0xee, 0xf4, 0xfa, 0x01, 
-  0x01, 0xfe, 0x01, 0x01, 0x0a, 0x00, 0xf0, 0xe1, 0xd8, 0xdd, 0xe6, 0xea, 0xdf, 0xcf, 0xc8, 0xd3, 
-  0xdb, 0xe2, 0xe7, 0xf1, 0xef, 0xeb, 0xf0, 0xf9, 0xf1, 0xdc, 0xe1, 0xe8, 0xef, 0xf9, 0xfc, 0x01, 
-  0x0a, 0x0f, 0x19, 0x1f, 0x23, 0x20, 0x22, 0x15, 0x0c, 0x07, 0xf8, 0xf1, 0xeb, 0xe3, 0xd4, 0xdb, 
-  0xe5, 0xec, 0xf3, 0xfb, 0xf5, 0xf6, 0xfc, 0x00, 0x05, 0xfd, 0x02, 0x0b, 0x0e, 0x08, 0x10, 0x1c, 
-  0x1f, 0x26, 0x2c, 0x30, 0x3c, 0x43, 0x46, 0x3c, 0x32, 0x2f, 0x32, 0x32, 0x29, 0x1f, 0xfa, 0xf0, 
-  0xf8, 0xfc, 0x05, 0x0a, 0x01, 0x02, 0x0c, 0x13, 0x14, 0x0e, 0x14, 0x1a, 0x22, 0x28, 0x30, 0x38, 
-  0x40, 0x3e, 0x3c, 0x43, 0x49, 0x52, 0x56, 0x4a, 0x42, 0x4a, 0x51, 0x52, 0x45, 0x41, 0x32, 0x23, 
-  0x2a, 0x29, 0x1e, 0x12, 0x08, 0x0b, 0x14, 0x1d, 0x1d, 0x14, 0x17, 0x20, 0x27, 0x30, 0x38, 0x3d, 
-  0x44, 0x4b, 0x51, 0x58, 0x61, 0x61, 0x5a, 0x50, 0x4a, 0x4f, 0x55, 0x55, 0x48, 0x3e, 0x34, 0x1f, 
-  0x1b, 0x1a, 0x0e, 0xfd, 0xf1, 0xf1, 0xec, 0xe9, 0xe2, 0xd8, 0xd8, 0xe2, 0xea, 0xef, 0xf5, 0xfb, 
-  0x01, 0x09, 0x10, 0x15, 0x19, 0x22, 0x26, 0x17, 0x15, 0x1b, 0x17, 0x13, 0x0e, 0x04, 0xf1, 0xe1, 
-  0xd8, 0xe0, 0xe1, 0xd7, 0xd5, 0xd6, 0xd6, 0xd7, 0xd9, 0xcc, 0xc0, 0xbc, 0xbc, 0xc1, 0xc7, 0xce, 
-  0xd7, 0xdb, 0xe2, 0xe9, 0xf1, 0xf9, 0xfc, 0xf1, 0xeb, 0xf1, 0xf8, 0xfc, 0xf3, 0xf5, 0xf6, 0xed, 
-  0xdc, 0xe0, 0xe4, 0xda, 0xdb, 0xe2, 0xe8, 0xed, 0xeb, 0xd6, 0xc6, 0xc7, 0xcc, 0xcd, 0xce, 0xcb, 
-  0xca, 0xcc, 0xd1, 0xd8, 0xdf, 0xe5, 0xe7, 0xdd, 0xd8, 0xe1, 0xea, 0xed, 0xe5, 0xe4, 0xea, 0xf3, 
-  0xe2, 0xdc, 0xdc, 0xca, 0xcc, 0xd4, 0xdb, 0xdf, 0xe3, 0xdc, 0xd8, 0xdc, 0xe1, 0xe7, 0xe4, 0xdc, 
-  0xd6, 0xd4, 0xd6, 0xd4, 0xd2, 0xd6, 0xd7, 0xcb, 0xc8, 0xd0, 0xd5, 0xd9, 0xd1, 0xd1, 0xd6, 0xe2, 
-  0xdb, 0xcb, 0xc5, 0xbf, 0xc4, 0xcc, 0xd5, 0xd3, 0xd4, 0xd1, 0xcc, 0xd0, 0xd6, 0xde, 0xe4, 0xeb, 
-  0xf0, 0xf6, 0xf5, 0xf6, 0xf9, 0xf9, 0xfa, 0xe8, 0xd9, 0xdd, 0xe5, 0xe8, 0xe0, 0xde, 0xe5, 0xec, 
-  0xf2, 0xdf, 0xcf, 0xd4, 0xda, 0xe1, 0xe7, 0xee, 0xf4, 0xf1, 0xee, 0xf0, 0xef, 0xf6, 0xfd, 0x03, 
-  0x09, 0x10, 0x16, 0x1c, 0x21, 0x27, 0x26, 0x13, 0x0b, 0x0d, 0x13, 0x14, 0x06, 0xfb, 0x01, 0x06, 
-  0x11, 0x00, 0xe6, 0xed, 0xf7, 0xff, 0x06, 0x0d, 0x15, 0x13, 0x0d, 0x11, 0x19, 0x1f, 0x26, 0x2d, 
-  0x2e, 0x30, 0x36, 0x3d, 0x44, 0x4a, 0x4b, 0x3f, 0x3c, 0x42, 0x42, 0x41, 0x38, 0x2e, 0x32, 0x35, 
-  0x38, 0x26, 0x06, 0x05, 0x0e, 0x15, 0x1c, 0x23, 0x2a, 0x2a, 0x24, 0x26, 0x2c, 0x32, 0x38, 0x3e, 
-  0x44, 0x4a, 0x50, 0x57, 0x57, 0x56, 0x58, 0x4b, 0x47, 0x4c, 0x52, 0x57, 0x50, 0x4a, 0x4a, 0x4c, 
-  0x4b, 0x3f, 0x26, 0x1b, 0x1f, 0x1c, 0x1f, 0x24, 0x2a, 0x2b, 0x23, 0x22, 0x28, 0x2f, 0x34, 0x3b, 
-  0x3f, 0x46, 0x4b, 0x50, 0x53, 0x58, 0x58, 0x4d, 0x47, 0x45, 0x48, 0x50, 0x4a, 0x42, 0x3d, 0x35, 
-  0x2c, 0x20, 0x10, 0xfa, 0xef, 0xe6, 0xe7, 0xea, 0xeb, 0xe6, 0xd8, 0xd5, 0xd8, 0xdd, 0xe1, 0xe6, 
-  0xec, 0xf3, 0xf7, 0xfd, 0x02, 0x0a, 0x0a, 0xfd, 0xf9, 0xfd, 0x01, 0x08, 0x06, 0xf8, 0xf5, 0xfc, 
-  0xfc, 0xe7, 0xcf, 0xbc, 0xb8, 0xbf, 0xc2, 0xc2, 0xc0, 0xc0, 0xb7, 0xb2, 0xb7, 0xb7, 0xb5, 0xb8, 
-  0xbe, 0xc4, 0xc9, 0xcf, 0xd5, 0xdb, 0xde, 0xd5, 0xd0, 0xd4, 0xda, 0xe0, 0xdf, 0xd6, 0xd9, 0xe0, 
-  0xde, 0xd4, 0xd5, 0xcc, 0xbe, 0xc5, 0xcc, 0xcf, 0xca, 0xc7, 0xbc, 0xb1, 0xb0, 0xb3, 0xba, 0xbf, 
-  0xc3, 0xc3, 0xc3, 0xc7, 0xcc, 0xd1, 0xd4, 0xca, 0xc7, 0xcc, 0xd5, 0xde, 0xde, 0xd5, 0xda, 0xe0, 
-  0xda, 0xd6, 0xdd, 0xdf, 0xce, 0xcf, 0xd4, 0xd7, 0xe1, 0xe6, 0xde, 0xd8, 0xdf, 0xe3, 0xe7, 0xe9, 
-  0xea, 0xea, 0xe7, 0xe4, 0xe7, 0xe9, 0xe6, 0xd9, 0xd3, 0xd8, 0xde, 0xe7, 0xe8, 0xe0, 0xe2, 0xe7, 
-  0xe0, 0xe1, 0xe6, 0xee, 0xe4, 0xda, 0xe2, 0xe8, 0xee, 0xf6, 0xf0, 0xe4, 0xe8, 0xee, 0xf5, 0xf9, 
-  0xff, 0x04, 0x08, 0x0a, 0x08, 0x0b, 0x0e, 0x03, 0xfd, 0x00, 0xff, 0x03, 0x05, 0xfc, 0xfc, 0xfe, 
-  0xf6, 0xf9, 0xff, 0x09, 0x08, 0xf6, 0xf9, 0x04, 0x08, 0x0f, 0x0d, 0x05, 0x05, 0x0b, 0x10, 0x12, 
-  0x16, 0x1c, 0x20, 0x25, 0x2a, 0x2f, 0x31, 0x22, 0x15, 0x17, 0x1c, 0x22, 0x26, 0x1d, 0x15, 0x0e, 
-  0x06, 0x06, 0x0b, 0x13, 0x19, 0x0b, 0x03, 0x0c, 0x11, 0x19, 0x17, 0x10, 0x10, 0x16, 0x1a, 0x1f, 
-  0x25, 0x2b, 0x32, 0x33, 0x35, 0x3c, 0x3e, 0x32, 0x2c, 0x30, 0x34, 0x35, 0x32, 0x29, 0x23, 0x1c, 
-  0x17, 0x19, 0x1a, 0x1b, 0x21, 0x1a, 0x06, 0x0d, 0x13, 0x18, 0x1b, 0x13, 0x10, 0x18, 0x1e, 0x22, 
-  0x28, 0x2c, 0x31, 0x35, 0x3b, 0x42, 0x45, 0x38, 0x2b, 0x2e, 0x34, 0x36, 0x3b, 0x36, 0x2e, 0x21, 
-  0x16, 0x17, 0x1c, 0x23, 0x28, 0x29, 0x14, 0x0e, 0x13, 0x15, 0x19, 0x11, 0x0d, 0x13, 0x19, 0x1e, 
-  0x23, 0x28, 0x2e, 0x32, 0x38, 0x3f, 0x41, 0x36, 0x2e, 0x32, 0x38, 0x3e, 0x3d, 0x38, 0x2e, 0x21, 
-  0x14, 0x0d, 0x0b, 0x0c, 0x0a, 0x0e, 0xff, 0xe6, 0xe6, 0xe9, 0xec, 0xe2, 0xd7, 0xd8, 0xdd, 0xe2, 
-  0xe6, 0xec, 0xf1, 0xf5, 0xfa, 0x01, 0x06, 0xfd, 0xf4, 0xf8, 0xfb, 0x00, 0x05, 0x05, 0xf9, 0xee, 
-  0xeb, 0xea, 0xf1, 0xf7, 0xfc, 0xf4, 0xde, 0xc9, 0xc4, 0xc7, 0xcc, 0xca, 0xc1, 0xc3, 0xc7, 0xc9, 
-  0xcb, 0xcd, 0xd1, 0xd7, 0xdc, 0xe2, 0xe7, 0xe0, 0xd7, 0xda, 0xe1, 0xe7, 0xee, 0xef, 0xdf, 0xd3, 
-  0xd4, 0xd9, 0xe1, 0xe8, 0xee, 0xed, 0xf2, 0xe0, 0xcb, 0xce, 0xd0, 0xcd, 0xc2, 0xc0, 0xc4, 0xcb, 
-  0xcf, 0xd3, 0xd8, 0xdc, 0xdf, 0xe1, 0xe7, 0xe1, 0xd7, 0xd9, 0xe1, 0xe7, 0xed, 0xef, 0xde, 0xd2, 
-  0xd6, 0xdb, 0xe1, 0xe4, 0xec, 0xf0, 0xf8, 0xf6, 0xe5, 0xe3, 0xe7, 0xea, 0xe3, 0xe0, 0xe5, 0xe9, 
-  0xec, 0xed, 0xf1, 0xf8, 0xfd, 0xf8, 0xf5, 0xea, 0xde, 0xdc, 0xe1, 0xe7, 0xed, 0xf0, 0xde, 0xcf, 
-  0xd2, 0xd7, 0xde, 0xe5, 0xe9, 0xef, 0xf5, 0xf7, 0xe8, 0xe2, 0xea, 0xed, 0xea, 0xe4, 0xe4, 0xe9, 
-  0xf0, 0xf5, 0xf9, 0xfa, 0xfe, 0x01, 0x04, 0x00, 0xf6, 0xf5, 0xfa, 0x00, 0x03, 0x03, 0xee, 0xdf, 
-  0xe0, 0xe6, 0xec, 0xf2, 0xf8, 0xff, 0x04, 0x0d, 0x04, 0xf5, 0xfc, 0xff, 0xfb, 0xf7, 0xfa, 0x00, 
-  0x08, 0x0a, 0x0b, 0x10, 0x15, 0x1a, 0x1f, 0x18, 0x09, 0x07, 0x0c, 0x12, 0x17, 0x18, 0x08, 0xfa, 
-  0xf9, 0xfc, 0x01, 0x04, 0x09, 0x10, 0x16, 0x1b, 0x1c, 0x0b, 0x07, 0x10, 0x0e, 0x07, 0x08, 0x0e, 
-  0x13, 0x18, 0x1d, 0x22, 0x28, 0x2e, 0x31, 0x2c, 0x1f, 0x20, 0x25, 0x27, 0x29, 0x28, 0x1a, 0x0c, 
-  0x0c, 0x10, 0x15, 0x1a, 0x1f, 0x20, 0x24, 0x28, 0x2d, 0x20, 0x14, 0x1b, 0x18, 0x11, 0x11, 0x16, 
-  0x1b, 0x21, 0x25, 0x2a, 0x2f, 0x34, 0x3a, 0x39, 0x2e, 0x2c, 0x30, 0x31, 0x36, 0x34, 0x26, 0x17, 
-  0x14, 0x15, 0x1b, 0x21, 0x26, 0x2a, 0x30, 0x34, 0x38, 0x34, 0x20, 0x20, 0x23, 0x18, 0x15, 0x1b, 
-  0x1e, 0x22, 0x29, 0x2e, 0x34, 0x3a, 0x3f, 0x3e, 0x33, 0x2e, 0x34, 0x3a, 0x3f, 0x3b, 0x33, 0x25, 
-  0x1d, 0x1f, 0x16, 0x0e, 0x0e, 0x10, 0x12, 0x19, 0x1a, 0x16, 0x00, 0xf2, 0xf4, 0xea, 0xe6, 0xe7, 
-  0xea, 0xed, 0xf1, 0xf6, 0xfb, 0x00, 0x05, 0x07, 0xfd, 0xf8, 0xfb, 0x00, 0x04, 0xff, 0xf7, 0xf1, 
-  0xeb, 0xec, 0xf2, 0xf7, 0xf7, 0xfc, 0x02, 0x04, 0x05, 0xf9, 0xe1, 0xd2, 0xd5, 0xd1, 0xca, 0xcc, 
-  0xd0, 0xd2, 0xd5, 0xda, 0xdf, 0xe3, 0xe6, 0xe8, 0xe0, 0xd8, 0xdb, 0xe1, 0xe5, 0xde, 0xda, 0xd6, 
-  0xd0, 0xd1, 0xd5, 0xdc, 0xe2, 0xe7, 0xeb, 0xe7, 0xe3, 0xe3, 0xe4, 0xd3, 0xce, 0xce, 0xc2, 0xc4, 
-  0xc7, 0xcc, 0xd2, 0xd8, 0xdc, 0xe0, 0xe2, 0xe6, 0xde, 0xd5, 0xd5, 0xdc, 0xe0, 0xd7, 0xd5, 0xd4, 
-  0xcd, 0xcb, 0xd1, 0xd7, 0xdd, 0xe2, 0xe9, 0xee, 0xf4, 0xf9, 0x01, 0xf8, 0xe7, 0xe7, 0xdf, 0xdc, 
-  0xdf, 0xe5, 0xe8, 0xee, 0xf3, 0xf7, 0xfd, 0xff, 0xf1, 0xde, 0xdb, 0xdf, 0xe0, 0xd8, 0xd7, 0xd7, 
-  0xcf, 0xcc, 0xd1, 0xd6, 0xde, 0xe3, 0xe8, 0xee, 0xf4, 0xfa, 0xfe, 0xfd, 0xec, 0xe9, 0xe4, 0xe0, 
-  0xe4, 0xe4, 0xe9, 0xed, 0xf2, 0xf7, 0xfb, 0xff, 0xfa, 0xf1, 0xf1, 0xf6, 0xf8, 0xee, 0xec, 0xef, 
-  0xe9, 0xe3, 0xe6, 0xec, 0xf1, 0xf6, 0xfa, 0x00, 0x08, 0x0f, 0x11, 0x17, 0x0a, 0xfd, 0xfb, 0xf5, 
-  0xf7, 0xfd, 0x03, 0x09, 0x0f, 0x11, 0x12, 0x17, 0x14, 0x0b, 0x08, 0x0a, 0x09, 0x03, 0x03, 0x07, 
-  0x03, 0xfd, 0xfc, 0x00, 0x05, 0x0a, 0x0e, 0x13, 0x17, 0x1e, 0x21, 0x27, 0x24, 0x12, 0x0d, 0x07, 
-  0x07, 0x0e, 0x13, 0x18, 0x1d, 0x23, 0x27, 0x2d, 0x2a, 0x20, 0x1a, 0x1c, 0x18, 0x14, 0x13, 0x15, 
-  0x13, 0x0d, 0x0d, 0x12, 0x18, 0x1c, 0x21, 0x25, 0x27, 0x2b, 0x31, 0x35, 0x37, 0x27, 0x1b, 0x14, 
-  0x11, 0x18, 0x1d, 0x23, 0x27, 0x2c, 0x31, 0x37, 0x36, 0x2b, 0x25, 0x29, 0x25, 0x1e, 0x1d, 0x20, 
-  0x23, 0x1b, 0x16, 0x18, 0x1c, 0x23, 0x2a, 0x2f, 0x35, 0x38, 0x3c, 0x40, 0x43, 0x3b, 0x28, 0x20, 
-  0x1b, 0x1e, 0x22, 0x26, 0x2b, 0x30, 0x35, 0x3a, 0x3c, 0x31, 0x2b, 0x2e, 0x29, 0x24, 0x24, 0x28, 
-  0x2e, 0x26, 0x1d, 0x18, 0x10, 0x0d, 0x0f, 0x13, 0x17, 0x1c, 0x21, 0x21, 0x1a, 0x14, 0xfe, 0xef, 
-  0xec, 0xeb, 0xef, 0xf2, 0xf6, 0xfa, 0xff, 0x03, 0x06, 0xfd, 0xf5, 0xf5, 0xf0, 0xeb, 0xed, 0xf2, 
-  0xf6, 0xf4, 0xed, 0xee, 0xf2, 0xf7, 0xfb, 0xfe, 0x02, 0x08, 0x0b, 0x0e, 0x0d, 0xfe, 0xe8, 0xd7, 
-  0xcf, 0xd0, 0xd4, 0xd8, 0xdc, 0xdf, 0xe2, 0xe6, 0xeb, 0xe4, 0xd9, 0xd8, 0xd1, 0xcd, 0xd0, 0xd6, 
-  0xdc, 0xdc, 0xd5, 0xd4, 0xd7, 0xdd, 0xdd, 0xd8, 0xd7, 0xdb, 0xdd, 0xe0, 0xe5, 0xe9, 0xe7, 0xd0, 
-  0xc4, 0xc3, 0xc7, 0xcd, 0xd2, 0xd7, 0xdb, 0xde, 0xe4, 0xe0, 0xd6, 0xd3, 0xcb, 0xc8, 0xcb, 0xd1, 
-  0xd5, 0xd7, 0xd2, 0xce, 0xd3, 0xd8, 0xdd, 0xe2, 0xe9, 0xee, 0xf1, 0xf6, 0xfa, 0xfc, 0x01, 0xf3, 
-  0xdf, 0xde, 0xe2, 0xe8, 0xee, 0xf6, 0xf8, 0xec, 0xec, 0xed, 0xe1, 0xd4, 0xc7, 0xc4, 0xc7, 0xcd, 
-  0xd0, 0xd5, 0xd6, 0xd6, 0xdc, 0xe4, 0xee, 0xf5, 0x00, 0x07, 0x0a, 0xe6, 0xd6, 0xe5, 0xec, 0xef, 
-  0xde, 0xda, 0xe1, 0xe2, 0xda, 0xe0, 0xeb, 0xf2, 0xfc, 0x00, 0xfe, 0xfc, 0xfa, 0xfb, 0x03, 0xec, 
-  0xce, 0xd8, 0xdd, 0xdb, 0xe1, 0xe8, 0xf2, 0xf6, 0xf0, 0xf3, 0xfe, 0x07, 0x12, 0x1b, 0x22, 0x29, 
-  0x1e, 0x12, 0x16, 0x07, 0xea, 0xe8, 0xf7, 0xfd, 0x05, 0x05, 0x02, 0xfb, 0xe5, 0xe1, 0xec, 0xf6, 
-  0x00, 0x0c, 0x13, 0x14, 0x18, 0x21, 0x29, 0x24, 0x0b, 0x00, 0x0b, 0x15, 0x19, 0x14, 0x15, 0x21, 
-  0x10, 0xf6, 0xf9, 0x03, 0x0f, 0x1c, 0x25, 0x2d, 0x36, 0x3d, 0x3c, 0x2b, 0x0c, 0xf6, 0xf8, 0x04, 
-  0x08, 0x05, 0x07, 0x0d, 0x04, 0xfe, 0x07, 0x14, 0x1e, 0x28, 0x32, 0x3b, 0x45, 0x4d, 0x53, 0x4b, 
-  0x3a, 0x16, 0xff, 0x0c, 0x0f, 0x0b, 0x0f, 0x1c, 0x1d, 0x16, 0x18, 0x15, 0x12, 0x18, 0x23, 0x30, 
-  0x3b, 0x42, 0x47, 0x34, 0x1c, 0x15, 0x07, 0x12, 0x1b, 0x12, 0x19, 0x26, 0x2d, 0x24, 0x29, 0x33, 
-  0x3e, 0x39, 0x2d, 0x35, 0x3f, 0x4b, 0x50, 0x45, 0x31, 0x32, 0x21, 0x10, 0x0d, 0xff, 0x05, 0x10, 
-  0x19, 0x14, 0x14, 0x20, 0x23, 0x1e, 0x19, 0x21, 0x29, 0x33, 0x3b, 0x33, 0x1d, 0x1c, 0x12, 0xfb, 
-  0xfd, 0xee, 0xdc, 0xde, 0xe8, 0xe7, 0xe3, 0xee, 0xf8, 0x04, 0x0a, 0x04, 0x01, 0x07, 0x0e, 0x09, 
-  0xf3, 0xef, 0xf8, 0xe9, 0xde, 0xd3, 0xd4, 0xe2, 0xec, 0xed, 0xe6, 0xf0, 0xfb, 0x07, 0x12, 0x1c, 
-  0x22, 0x14, 0x03, 0xf4, 0xdd, 0xd1, 0xdd, 0xd5, 0xc6, 0xc0, 0xc5, 0xc3, 0xc0, 0xbf, 0xb6, 0xbd, 
-  0xc8, 0xd3, 0xe0, 0xeb, 0xf2, 0xf4, 0xf2, 0xeb, 0xd4, 0xc5, 0xcf, 0xd3, 0xbf, 0xb3, 0xb9, 0xc4, 
-  0xcf, 0xd7, 0xc6, 0xb3, 0xbc, 0xc9, 0xd6, 0xe1, 0xec, 0xf7, 0xff, 0xf9, 0xd7, 0xc0, 0xc4, 0xd1, 
-  0xc0, 0xab, 0xb5, 0xc2, 0xcb, 0xce, 0xc6, 0xc4, 0xd0, 0xdb, 0xe6, 0xf2, 0xfb, 0x06, 0x0f, 0x19, 
-  0x0b, 0xf7, 0xf5, 0xed, 0xda, 0xbd, 0xc2, 0xd1, 0xdb, 0xe7, 0xe6, 0xd9, 0xd2, 0xd4, 0xd3, 0xdb, 
-  0xe3, 0xef, 0xf8, 0x04, 0xfc, 0xdf, 0xd8, 0xe2, 0xe2, 0xc4, 0xbc, 0xcd, 0xd7, 0xe4, 0xe5, 0xe0, 
-  0xe7, 0xf1, 0xfb, 0xfa, 0xf3, 0xfc, 0x05, 0x10, 0x0c, 0xf3, 0xee, 0xf1, 0xe8, 0xcb, 0xb9, 0xc8, 
-  0xd3, 0xe0, 0xe6, 0xe0, 0xe4, 0xed, 0xf2, 0xfb, 0x06, 0x0e, 0x18, 0x22, 0x24, 0x0a, 0xfe, 0x09, 
-  0x0d, 0x01, 0xed, 0xed, 0xe7, 0xe9, 0xf4, 0xf0, 0xf1, 0xfc, 0x08, 0x0b, 0x06, 0x08, 0x11, 0x1b, 
-  0x22, 0x0e, 0xfc, 0x08, 0x0d, 0x05, 0xf0, 0xe7, 0xf3, 0xfb, 0x05, 0x04, 0x01, 0x0a, 0x15, 0x1f, 
-  0x29, 0x33, 0x3c, 0x42, 0x3c, 0x22, 0x08, 0x0f, 0x14, 0x0e, 0x07, 0xf4, 0xf1, 0xf4, 0xfb, 0xfe, 
-  0xf6, 0xfd, 0x09, 0x15, 0x21, 0x2c, 0x32, 0x37, 0x3f, 0x36, 0x1a, 0x1b, 0x21, 0x1a, 0x1d, 0x0f, 
-  0x0e, 0x1c, 0x22, 0x28, 0x18, 0x0c, 0x13, 0x1d, 0x29, 0x33, 0x3e, 0x41, 0x3f, 0x33, 0x12, 0x0d, 
-  0x15, 0x0d, 0x13, 0x0e, 0x03, 0x10, 0x18, 0x1c, 0x16, 0x13, 0x1e, 0x29, 0x34, 0x3d, 0x48, 0x51, 
-  0x59, 0x5b, 0x40, 0x33, 0x36, 0x1f, 0x1b, 0x1f, 0x0f, 0x12, 0x1e, 0x21, 0x17, 0x08, 0x0e, 0x19, 
-  0x24, 0x2d, 0x37, 0x41, 0x49, 0x52, 0x37, 0x14, 0x0a, 0xfe, 0x00, 0x0b, 0x02, 0xfb, 0x09, 0x13, 
-  0x13, 0x04, 0x01, 0x07, 0x0d, 0x0e, 0x09, 0x12, 0x18, 0x23, 0x11, 0xf4, 0xec, 0xdd, 0xdb, 0xe5, 
-  0xe5, 0xd6, 0xdd, 0xea, 0xed, 0xe9, 0xeb, 0xf4, 0xf8, 0x02, 0x08, 0x14, 0x1a, 0x24, 0x19, 0xff, 
-  0xfb, 0xf7, 0xf9, 0x04, 0x02, 0xda, 0xc4, 0xce, 0xd2, 0xd0, 0xcd, 0xd5, 0xd8, 0xda, 0xdd, 0xe6, 
-  0xee, 0xf7, 0xf2, 0xd6, 0xce, 0xc4, 0xbe, 0xc1, 0xc5, 0xbf, 0xaf, 0xba, 0xc3, 0xc1, 0xbc, 0xc4, 
-  0xd0, 0xd9, 0xe3, 0xec, 0xf5, 0xfc, 0xf5, 0xd1, 0xc0, 0xbc, 0xc0, 0xc8, 0xcc, 0xcb, 0xb6, 0xb6, 
-  0xc4, 0xc6, 0xc1, 0xc6, 0xd1, 0xda, 0xe6, 0xee, 0xf2, 0xf6, 0xfb, 0xe6, 0xcf, 0xc9, 0xcc, 0xd9, 
-  0xe1, 0xec, 0xe5, 0xda, 0xe7, 0xeb, 0xdf, 0xd5, 0xdc, 0xe8, 0xf5, 0xfb, 0x01, 0x05, 0x06, 0xf3, 
-  0xd0, 0xbf, 0xbd, 0xc9, 0xd2, 0xdd, 0xe0, 0xd1, 0xd2, 0xd8, 0xd0, 0xce, 0xd8, 0xe2, 0xec, 0xf4, 
-  0xfd, 0x07, 0x10, 0x08, 0xeb, 0xdb, 0xdb, 0xdc, 0xe0, 0xe8, 0xef, 0xe0, 0xd8, 0xe1, 0xd8, 0xd2, 
-  0xda, 0xe6, 0xf0, 0xf8, 0x04, 0x0e, 0x18, 0x15, 0xf6, 0xdc, 0xdc, 0xe5, 0xf1, 0xf8, 0x01, 0xfe, 
-  0xf0, 0xfb, 0xff, 0xf6, 0xfc, 0x05, 0x0e, 0x11, 0x10, 0x16, 0x20, 0x21, 0x05, 0xe4, 0xdf, 0xe5, 
-  0xef, 0xfa, 0x05, 0x0c, 0xfd, 0xfd, 0x08, 0x00, 0x00, 0x06, 0x0e, 0x17, 0x1f, 0x28, 0x30, 0x37, 
-  0x21, 0xfe, 0xf9, 0x03, 0x0d, 0x18, 0x1e, 0x25, 0x13, 0x01, 0x0d, 0x07, 0x01, 0x07, 0x0c, 0x13, 
-  0x1a, 0x25, 0x2d, 0x34, 0x25, 0x01, 0xf9, 0x05, 0x0f, 0x17, 0x1a, 0x22, 0x24, 0x14, 0x17, 0x1b, 
-  0x13, 0x1a, 0x23, 0x2d, 0x36, 0x40, 0x46, 0x4c, 0x3d, 0x0e, 0xfd, 0x04, 0x0c, 0x16, 0x1a, 0x1d, 
-  0x24, 0x1a, 0x12, 0x1b, 0x13, 0x16, 0x1f, 0x28, 0x32, 0x39, 0x3e, 0x44, 0x43, 0x1d, 0x06, 0x0e, 
-  0x18, 0x23, 0x2e, 0x35, 0x3e, 0x3c, 0x2d, 0x31, 0x28, 0x1c, 0x20, 0x26, 0x2e, 0x35, 0x3c, 0x3f, 
-  0x40, 0x1f, 0x02, 0x09, 0x13, 0x1d, 0x25, 0x2e, 0x2e, 0x28, 0x0e, 0x07, 0x07, 0xfe, 0x08, 0x10, 
-  0x19, 0x22, 0x2d, 0x32, 0x2e, 0x0c, 0xe8, 0xe7, 0xed, 0xf1, 0xf3, 0xfa, 0xfe, 0x07, 0xfb, 0xe9, 
-  0xea, 0xe1, 0xe4, 0xef, 0xf8, 0x00, 0x0a, 0x13, 0x19, 0x06, 0xdd, 0xd6, 0xdf, 0xeb, 0xf3, 0xfb, 
-  0x02, 0x0c, 0x0f, 0xfe, 0xfe, 0xfc, 0xf9, 0x04, 0xfc, 0xec, 0xed, 0xf2, 0xf7, 0xea, 0xc4, 0xb5, 
-  0xbc, 0xc5, 0xce, 0xd6, 0xde, 0xda, 0xdc, 0xce, 0xc2, 0xc2, 0xbb, 0xbf, 0xc8, 0xcf, 0xd8, 0xe1, 
-  0xe9, 0xe2, 0xc0, 0xae, 0xb5, 0xbf, 0xcc, 0xd4, 0xdc, 0xe0, 0xe3, 0xda, 0xca, 0xc8, 0xc4, 0xc4, 
-  0xcc, 0xd2, 0xdc, 0xe7, 0xf2, 0xec, 0xcf, 0xba, 0xbc, 0xc6, 0xd1, 0xd7, 0xdd, 0xe4, 0xec, 0xf2, 
-  0xe4, 0xdc, 0xda, 0xd9, 0xe4, 0xed, 0xf8, 0x02, 0x0a, 0x05, 0xe8, 0xc9, 0xc5, 0xcf, 0xda, 0xe3, 
-  0xe7, 0xef, 0xf2, 0xf5, 0xeb, 0xd9, 0xd5, 0xd3, 0xdc, 0xe3, 0xea, 0xf2, 0xf7, 0xf7, 0xe1, 0xc9, 
-  0xc1, 0xc9, 0xd2, 0xdc, 0xe6, 0xf0, 0xf7, 0x02, 0x06, 0xf3, 0xe7, 0xde, 0xdd, 0xe7, 0xf0, 0xf9, 
-  0xfe, 0x00, 0xee, 0xd8, 0xcf, 0xd4, 0xde, 0xe8, 0xf2, 0xf8, 0x00, 0x07, 0x0e, 0x02, 0xf1, 0xed, 
-  0xef, 0xf8, 0xff, 0x07, 0x10, 0x15, 0x09, 0xf5, 0xe8, 0xe5, 0xed, 0xf1, 0xf4, 0xfd, 0x07, 0x0e, 
-  0x14, 0x12, 0xfe, 0xf5, 0xf8, 0x00, 0x0b, 0x12, 0x1b, 0x1f, 0x15, 0x01, 0xf0, 0xea, 0xf3, 0xfc, 
-  0x07, 0x0f, 0x17, 0x1f, 0x26, 0x2d, 0x1e, 0x0f, 0x0f, 0x11, 0x18, 0x1c, 0x1e, 0x1f, 0x18, 0x0a, 
-  0xf6, 0xed, 0xf3, 0xfe, 0x08, 0x12, 0x19, 0x22, 0x2a, 0x32, 0x2c, 0x18, 0x11, 0x13, 0x1b, 0x24, 
-  0x2c, 0x32, 0x2a, 0x1e, 0x0e, 0x04, 0x07, 0x11, 0x1b, 0x23, 0x26, 0x29, 0x2d, 0x32, 0x36, 0x22, 
-  0x12, 0x12, 0x17, 0x21, 0x2b, 0x32, 0x2d, 0x23, 0x15, 0x09, 0x07, 0x0f, 0x1a, 0x21, 0x29, 0x30, 
-  0x39, 0x3f, 0x47, 0x3c, 0x25, 0x24, 0x2a, 0x32, 0x3b, 0x41, 0x3a, 0x2d, 0x1f, 0x0c, 0x05, 0x0b, 
-  0x14, 0x19, 0x22, 0x2a, 0x33, 0x3b, 0x43, 0x45, 0x2b, 0x1d, 0x19, 0x15, 0x1a, 0x1e, 0x19, 0x12, 
-  0x0a, 0xfc, 0xf5, 0xf8, 0x01, 0x0a, 0x11, 0x11, 0x11, 0x16, 0x1a, 0x1c, 0x09, 0xf0, 0xf0, 0xf7, 
-  0xfe, 0x03, 0xfc, 0xf7, 0xef, 0xe4, 0xdb, 0xdc, 0xe4, 0xec, 0xf3, 0xfb, 0x03, 0x0b, 0x11, 0x18, 
-  0x14, 0xfa, 0xf4, 0xfc, 0x02, 0x0c, 0x09, 0x05, 0x01, 0xf7, 0xeb, 0xe5, 0xda, 0xce, 0xd5, 0xdd, 
-  0xe3, 0xe8, 0xee, 0xf4, 0xf3, 0xd2, 0xbb, 0xc3, 0xc8, 0xd0, 0xcd, 0xc7, 0xc5, 0xbb, 0xb1, 0xaa, 
-  0xb1, 0xb9, 0xc3, 0xcd, 0xd5, 0xdd, 0xe5, 0xeb, 0xf3, 0xe9, 0xcd, 0xcb, 0xd1, 0xd9, 0xd6, 0xcd, 
-  0xcf, 0xc3, 0xb9, 0xb3, 0xb7, 0xbf, 0xc9, 0xd3, 0xdd, 0xe4, 0xea, 0xf1, 0xf8, 0xf9, 0xdd, 0xd2, 
-  0xdb, 0xe2, 0xe5, 0xdd, 0xe1, 0xdc, 0xd3, 0xcd, 0xcc, 0xd5, 0xdd, 0xe5, 0xea, 0xf4, 0xfa, 0xff, 
-  0x04, 0x0a, 0xf7, 0xdf, 0xe6, 0xe6, 0xe0, 0xd7, 0xd8, 0xd7, 0xcb, 0xc5, 0xc0, 0xc8, 0xcf, 0xd7, 
-  0xe0, 0xea, 0xf1, 0xf9, 0x00, 0x08, 0x03, 0xe5, 0xe2, 0xed, 0xef, 0xe7, 0xe4, 0xe7, 0xdd, 0xd3, 
-  0xcb, 0xcd, 0xd4, 0xdd, 0xe8, 0xf2, 0xfb, 0x03, 0x0c, 0x12, 0x15, 0xfb, 0xeb, 0xf5, 0xf8, 0xf3, 
-  0xf2, 0xf7, 0xef, 0xe6, 0xdf, 0xdf, 0xe7, 0xf0, 0xfb, 0x04, 0x0d, 0x11, 0x18, 0x1d, 0x26, 0x17, 
-  0xf6, 0xfa, 0x00, 0xfa, 0xf9, 0x00, 0xfc, 0xf2, 0xed, 0xea, 0xf1, 0xf8, 0x02, 0x0b, 0x14, 0x1b, 
-  0x22, 0x2b, 0x32, 0x31, 0x13, 0x09, 0x13, 0x0d, 0x09, 0x0f, 0x10, 0x05, 0xfd, 0xf6, 0xfa, 0x02, 
-  0x06, 0x0e, 0x15, 0x1e, 0x24, 0x2f, 0x35, 0x3b, 0x26, 0x0e, 0x14, 0x10, 0x0d, 0x12, 0x15, 0x0d, 
-  0x06, 0x02, 0x02, 0x0c, 0x13, 0x1d, 0x26, 0x2f, 0x35, 0x3e, 0x43, 0x49, 0x40, 0x1e, 0x1c, 0x1c, 
-  0x14, 0x16, 0x18, 0x12, 0x0b, 0x07, 0x04, 0x0c, 0x15, 0x1e, 0x27, 0x2f, 0x36, 0x3d, 0x44, 0x49, 
-  0x4d, 0x31, 0x21, 0x23, 0x1d, 0x21, 0x26, 0x24, 0x1a, 0x16, 0x11, 0x14, 0x1c, 0x23, 0x2c, 0x33, 
-  0x39, 0x3b, 0x41, 0x46, 0x4e, 0x3e, 0x22, 0x1e, 0x1b, 0x1c, 0x24, 0x1f, 0x09, 0xfb, 0xf4, 0xf4, 
-  0xff, 0x06, 0x10, 0x19, 0x21, 0x27, 0x2f, 0x35, 0x3b, 0x35, 0x0d, 0xf6, 0xf0, 0xef, 0xf6, 0xf9, 
-  0xf0, 0xe6, 0xde, 0xd9, 0xe2, 0xea, 0xf4, 0xfc, 0x05, 0x0c, 0x12, 0x18, 0x1c, 0x21, 0x0b, 0xee, 
-  0xea, 0xeb, 0xf2, 0xfa, 0xf4, 0xeb, 0xe7, 0xe2, 0xe8, 0xf2, 0xfa, 0x02, 0x0a, 0x12, 0x16, 0x1b, 
-  0x0e, 0x03, 0xfa, 0xd3, 0xba, 0xb7, 0xba, 0xc4, 0xc1, 0xb6, 0xb3, 0xad, 0xae, 0xb6, 0xbe, 0xc7, 
-  0xcf, 0xd8, 0xdf, 0xe6, 0xee, 0xf3, 0xf4, 0xd8, 0xba, 0xbc, 0xc0, 0xc9, 0xcb, 0xc1, 0xbd, 0xb7, 
-  0xb6, 0xbe, 0xc4, 0xca, 0xd2, 0xdc, 0xe6, 0xed, 0xf5, 0xfa, 0xff, 0xef, 0xc7, 0xc0, 0xc8, 0xd0, 
-  0xd8, 0xcf, 0xca, 0xc7, 0xc2, 0xc9, 0xd3, 0xdc, 0xe5, 0xee, 0xf7, 0xfe, 0x06, 0x0c, 0x11, 0x0b, 
-  0xe3, 0xcf, 0xd8, 0xda, 0xe4, 0xe0, 0xda, 0xd5, 0xc7, 0xc3, 0xcb, 0xd4, 0xdb, 0xe3, 0xec, 0xf4, 
-  0xfb, 0x02, 0x06, 0x0a, 0xed, 0xc8, 0xcf, 0xd8, 0xe2, 0xe2, 0xd7, 0xd5, 0xd0, 0xcf, 0xd7, 0xe0, 
-  0xe7, 0xf0, 0xf8, 0xfe, 0x02, 0x0a, 0x11, 0x18, 0x08, 0xdc, 0xd6, 0xe1, 0xe9, 0xee, 0xe3, 0xe1, 
-  0xdf, 0xdc, 0xe2, 0xeb, 0xf4, 0xfb, 0x04, 0x0d, 0x16, 0x1c, 0x22, 0x27, 0x22, 0xfb, 0xe5, 0xef, 
-  0xf7, 0xff, 0xf7, 0xee, 0xeb, 0xe5, 0xe9, 0xf3, 0xfd, 0x04, 0x0c, 0x15, 0x1e, 0x25, 0x2b, 0x31, 
-  0x33, 0x17, 0xf4, 0xf7, 0x02, 0x0a, 0x08, 0xfd, 0xfe, 0xf9, 0xf7, 0xfe, 0x08, 0x10, 0x17, 0x1f, 
-  0x26, 0x2d, 0x33, 0x38, 0x38, 0x28, 0x03, 0xfa, 0x06, 0x0f, 0x11, 0x05, 0x04, 0x01, 0xfc, 0x02, 
-  0x0b, 0x14, 0x1b, 0x24, 0x2d, 0x35, 0x3a, 0x42, 0x46, 0x3e, 0x20, 0x06, 0x0d, 0x18, 0x1e, 0x15, 
-  0x0d, 0x0d, 0x06, 0x09, 0x0f, 0x15, 0x1c, 0x25, 0x2f, 0x39, 0x3f, 0x45, 0x4a, 0x45, 0x31, 0x12, 
-  0x0f, 0x1b, 0x22, 0x1e, 0x14, 0x16, 0x11, 0x10, 0x17, 0x1f, 0x25, 0x2a, 0x33, 0x3d, 0x45, 0x4a, 
-  0x50, 0x4b, 0x3f, 0x23, 0x10, 0x18, 0x20, 0x22, 0x18, 0x16, 0x15, 0x0e, 0x13, 0x12, 0x0f, 0x10, 
-  0x17, 0x1f, 0x29, 0x2e, 0x35, 0x34, 0x2c, 0x1a, 0xfe, 0x01, 0x0b, 0x0d, 0x01, 0xf2, 0xed, 0xe4, 
-  0xe5, 0xec, 0xf3, 0xf9, 0x00, 0x05, 0x0e, 0x15, 0x1c, 0x1d, 0x15, 0x0b, 0xee, 0xe3, 0xee, 0xf3, 
-  0xef, 0xe6, 0xe9, 0xe5, 0xe4, 0xeb, 0xf2, 0xfb, 0x02, 0x09, 0x11, 0x19, 0x1f, 0x22, 0x1b, 0x18, 
-  0x04, 0xeb, 0xf0, 0xee, 0xd0, 0xb5, 0xb4, 0xb2, 0xaf, 0xb4, 0xbc, 0xc4, 0xca, 0xd0, 0xd9, 0xe2, 
-  0xe8, 0xec, 0xe6, 0xe3, 0xdb, 0xbf, 0xba, 0xc5, 0xc8, 0xc0, 0xbb, 0xbd, 0xb8, 0xba, 0xc1, 0xc9, 
-  0xd1, 0xd7, 0xdf, 0xe7, 0xf0, 0xf3, 0xee, 0xe9, 0xeb, 0xd5, 0xc2, 0xcc, 0xd2, 0xcc, 0xc4, 0xc7, 
-  0xc5, 0xc4, 0xcb, 0xd3, 0xdd, 0xe4, 0xec, 0xf6, 0xff, 0x04, 0x01, 0xfe, 0x00, 0xf3, 0xd9, 0xd9, 
-  0xe3, 0xe1, 0xd8, 0xd6, 0xd8, 0xd4, 0xd7, 0xdd, 0xe6, 0xef, 0xf0, 0xf0, 0xf4, 0xfa, 0xf9, 0xf6, 
-  0xf8, 0xf6, 0xdd, 0xd0, 0xda, 0xdb, 0xd3, 0xd0, 0xd4, 0xcf, 0xd0, 0xd7, 0xdf, 0xe8, 0xee, 0xf7, 
-  0x00, 0x08, 0x08, 0x03, 0x04, 0x07, 0xf5, 0xdb, 0xdf, 0xe8, 0xe2, 0xdb, 0xde, 0xdc, 0xd8, 0xde, 
-  0xe6, 0xf0, 0xf8, 0x01, 0x0a, 0x13, 0x14, 0x10, 0x11, 0x15, 0x0f, 0xf4, 0xec, 0xf7, 0xf3, 0xea, 
-  0xea, 0xec, 0xe7, 0xe9, 0xf1, 0xf9, 0x00, 0x07, 0x0e, 0x19, 0x1e, 0x19, 0x1a, 0x1d, 0x1e, 0x0a, 
-  0xf5, 0xfd, 0x00, 0xf7, 0xf4, 0xf7, 0xf3, 0xf3, 0xfa, 0x01, 0x0a, 0x11, 0x1a, 0x23, 0x29, 0x24, 
-  0x21, 0x25, 0x29, 0x1f, 0x02, 0x00, 0x09, 0xff, 0xf8, 0xfb, 0xfb, 0xf8, 0xfd, 0x04, 0x0c, 0x14, 
-  0x1c, 0x24, 0x2c, 0x2a, 0x26, 0x2a, 0x2d, 0x2e, 0x15, 0x04, 0x0d, 0x0a, 0x03, 0x04, 0x06, 0x02, 
-  0x04, 0x0b, 0x12, 0x19, 0x20, 0x27, 0x2f, 0x2e, 0x27, 0x2b, 0x30, 0x35, 0x27, 0x0d, 0x0f, 0x11, 
-  0x08, 0x07, 0x0a, 0x08, 0x06, 0x0b, 0x12, 0x1b, 0x23, 0x2a, 0x31, 0x33, 0x2d, 0x2d, 0x32, 0x38, 
-  0x35, 0x19, 0x0e, 0x15, 0x0d, 0x07, 0x0b, 0x0a, 0x04, 0x05, 0x0d, 0x17, 0x1f, 0x26, 0x2b, 0x26, 
-  0x1b, 0x19, 0x1f, 0x25, 0x29, 0x15, 0xfd, 0x02, 0x00, 0xf7, 0xf8, 0xf9, 0xf6, 0xf5, 0xfb, 0xff, 
-  0x03, 0x05, 0x0b, 0x0e, 0x0a, 0x08, 0x0d, 0x13, 0x18, 0x0f, 0xf2, 0xee, 0xf3, 0xe8, 0xe6, 0xe9, 
-  0xe7, 0xe4, 0xe8, 0xf0, 0xf9, 0x01, 0x07, 0x0d, 0x0c, 0x09, 0x0c, 0x13, 0x19, 0x1b, 0x04, 0xf0, 
-  0xf7, 0xf0, 0xe8, 0xe5, 0xe0, 0xd9, 0xd9, 0xdc, 0xd6, 0xda, 0xe1, 0xe7, 0xe8, 0xe6, 0xe8, 0xef, 
-  0xf4, 0xfa, 0xef, 0xd3, 0xd2, 0xd2, 0xc9, 0xca, 0xcc, 0xc8, 0xc6, 0xcc, 0xd3, 0xde, 0xe5, 0xec, 
-  0xed, 0xea, 0xec, 0xf1, 0xf9, 0xfe, 0xfe, 0xe2, 0xd5, 0xd9, 0xce, 0xcc, 0xd1, 0xd1, 0xcd, 0xd1, 
-  0xd9, 0xe2, 0xeb, 0xf2, 0xf6, 0xf3, 0xf6, 0xfb, 0x03, 0x08, 0x0d, 0xfd, 0xe2, 0xe4, 0xdf, 0xda, 
-  0xde, 0xdf, 0xdb, 0xdc, 0xe2, 0xea, 0xf2, 0xf9, 0xfe, 0xfb, 0xfb, 0xff, 0x05, 0x06, 0x08, 0x04, 
-  0xe6, 0xdd, 0xdf, 0xd7, 0xd9, 0xdc, 0xd9, 0xd6, 0xdb, 0xe2, 0xeb, 0xf4, 0xfa, 0xf8, 0xf8, 0xfe, 
-  0x04, 0x0d, 0x10, 0x15, 0xfe, 0xe7, 0xe9, 0xe0, 0xde, 0xe3, 0xe1, 0xdc, 0xdf, 0xe7, 0xf0, 0xf8, 
-  0xfe, 0xfd, 0xfb, 0x02, 0x08, 0x12, 0x17, 0x1e, 0x16, 0xf7, 0xf1, 0xee, 0xe7, 0xeb, 0xed, 0xea, 
-  0xe9, 0xef, 0xf6, 0xff, 0x05, 0x05, 0x02, 0x07, 0x0c, 0x15, 0x1c, 0x20, 0x23, 0x09, 0xf7, 0xf8, 
-  0xef, 0xf0, 0xf4, 0xf2, 0xef, 0xf3, 0xfc, 0x03, 0x0b, 0x0c, 0x08, 0x0b, 0x13, 0x19, 0x23, 0x28, 
-  0x2f, 0x20, 0x03, 0x00, 0xf9, 0xf4, 0xf9, 0xf8, 0xf3, 0xf3, 0xfb, 0x02, 0x0a, 0x0e, 0x0c, 0x0d, 
-  0x15, 0x1c, 0x23, 0x29, 0x30, 0x2e, 0x10, 0x03, 0x00, 0xf6, 0xf9, 0xfb, 0xf8, 0xf6, 0xfd, 0x05, 
-  0x0f, 0x16, 0x12, 0x11, 0x17, 0x1d, 0x24, 0x2b, 0x30, 0x35, 0x21, 0x07, 0x04, 0xfb, 0xfb, 0x00, 
-  0xfe, 0xfb, 0xfe, 0x06, 0x0e, 0x17, 0x13, 0x11, 0x16, 0x1e, 0x23, 0x2b, 0x30, 0x36, 0x2f, 0x11, 
-  0x06, 0x00, 0xfa, 0x00, 0x00, 0xfd, 0xfc, 0x03, 0x0a, 0x12, 0x12, 0x0e, 0x12, 0x19, 0x20, 0x27, 
-  0x2c, 0x2b, 0x2b, 0x12, 0xfc, 0xf8, 0xf0, 0xf3, 0xf6, 0xf3, 0xef, 0xf3, 0xfa, 0x02, 0x05, 0x01, 
-  0x04, 0x0b, 0x12, 0x13, 0x18, 0x1b, 0x20, 0x15, 0xf7, 0xed, 0xe6, 0xe4, 0xea, 0xe8, 0xe5, 0xe7, 
-  0xee, 0xf5, 0xfa, 0xf5, 0xf6, 0xfd, 0x06, 0x0c, 0x14, 0x1b, 0x1e, 0x1d, 0x02, 0xf0, 0xea, 0xe4, 
-  0xea, 0xec, 0xe6, 0xe0, 0xe4, 0xea, 0xf0, 0xed, 0xeb, 0xf1, 0xf8, 0xfc, 0xfa, 0x00, 0x05, 0x0a, 
-  0xfa, 0xde, 0xd6, 0xcf, 0xd1, 0xd7, 0xd5, 0xd2, 0xd6, 0xdd, 0xe2, 0xe0, 0xdd, 0xe3, 0xea, 0xf3, 
-  0xfa, 0x03, 0x08, 0x0d, 0x0a, 0xee, 0xdb, 0xd4, 0xd2, 0xd8, 0xd8, 0xd5, 0xd6, 0xdc, 0xe2, 0xe4, 
-  0xe2, 0xe6, 0xee, 0xf8, 0xff, 0x06, 0x0e, 0x13, 0x18, 0x05, 0xe9, 0xe0, 0xda, 0xdf, 0xe2, 0xdf, 
-  0xdd, 0xe2, 0xea, 0xed, 0xea, 0xeb, 0xf2, 0xfa, 0x03, 0x09, 0x11, 0x15, 0x1d, 0x16, 0xf6, 0xe2, 
-  0xda, 0xda, 0xdf, 0xde, 0xdd, 0xdf, 0xe6, 0xea, 0xe8, 0xe8, 0xee, 0xf6, 0xfe, 0x05, 0x0d, 0x14, 
-  0x19, 0x1c, 0x04, 0xea, 0xe3, 0xdf, 0xe4, 0xe5, 0xe2, 0xe2, 0xe7, 0xed, 0xeb, 0xeb, 0xf0, 0xf7, 
-  0x00, 0x0a, 0x10, 0x18, 0x1c, 0x22, 0x17, 0xf8, 0xeb, 0xe7, 0xe9, 0xee, 0xea, 0xe9, 0xec, 0xf3, 
-  0xf1, 0xf0, 0xf5, 0xfd, 0x05, 0x0e, 0x15, 0x1b, 0x20, 0x25, 0x25, 0x09, 0xf1, 0xec, 0xeb, 0xf1, 
-  0xf1, 0xee, 0xef, 0xf5, 0xf6, 0xf5, 0xf9, 0x00, 0x09, 0x11, 0x19, 0x1e, 0x25, 0x28, 0x2e, 0x1e, 
-  0xfe, 0xf3, 0xf0, 0xf5, 0xf9, 0xf5, 0xf4, 0xf7, 0xf8, 0xf4, 0xf8, 0xfe, 0x06, 0x0e, 0x17, 0x1d, 
-  0x24, 0x29, 0x2f, 0x2c, 0x0c, 0xf7, 0xf3, 0xf5, 0xfb, 0xfa, 0xf7, 0xf9, 0xfa, 0xf5, 0xf7, 0xff, 
-  0x07, 0x10, 0x19, 0x21, 0x27, 0x2e, 0x32, 0x36, 0x1e, 0xfe, 0xf5, 0xf4, 0xfa, 0xfc, 0xf8, 0xf9, 
-  0xfb, 0xf8, 0xf8, 0xff, 0x07, 0x0f, 0x17, 0x21, 0x27, 0x2e, 0x31, 0x37, 0x2e, 0x09, 0xf7, 0xf5, 
-  0xf8, 0xfe, 0xf9, 0xf7, 0xfa, 0xf7, 0xf5, 0xfb, 0x02, 0x0a, 0x12, 0x1b, 0x22, 0x28, 0x2e, 0x33, 
-  0x34, 0x17, 0xf6, 0xee, 0xed, 0xf4, 0xf3, 0xef, 0xf2, 0xf0, 0xed, 0xf1, 0xf9, 0xff, 0x06, 0x0e, 
-  0x17, 0x1d, 0x23, 0x27, 0x2e, 0x1f, 0xf7, 0xe6, 0xe4, 0xe9, 0xed, 0xe7, 0xe7, 0xe5, 0xe2, 0xe6, 
-  0xed, 0xf4, 0xfb, 0x04, 0x0d, 0x13, 0x19, 0x1f, 0x25, 0x24, 0x01, 0xe7, 0xe5, 0xe6, 0xeb, 0xe8, 
-  0xe7, 0xe5, 0xdd, 0xdd, 0xe4, 0xec, 0xf4, 0xfb, 0x03, 0x0b, 0x0f, 0x16, 0x1a, 0x20, 0x0b, 0xe3, 
-  0xd5, 0xd5, 0xdb, 0xdb, 0xd7, 0xd7, 0xd1, 0xd2, 0xd9, 0xe2, 0xea, 0xf1, 0xf9, 0x01, 0x05, 0x0b, 
-  0x11, 0x18, 0x12, 0xeb, 0xd8, 0xd9, 0xdc, 0xe0, 0xdb, 0xd9, 0xd2, 0xd0, 0xd6, 0xdf, 0xe8, 0xef, 
-  0xf7, 0x00, 0x06, 0x0c, 0x14, 0x19, 0x1e, 0x01, 0xe1, 0xde, 0xdf, 0xe5, 0xe3, 0xdf, 0xda, 0xd5, 
-  0xda, 0xe3, 0xec, 0xf2, 0xfa, 0x03, 0x0c, 0x11, 0x18, 0x1c, 0x23, 0x15, 0xed, 0xe0, 0xe1, 0xe7, 
-  0xe9, 0xe1, 0xd9, 0xd2, 0xd5, 0xdd, 0xe8, 0xf0, 0xf7, 0xff, 0x09, 0x0f, 0x16, 0x1c, 0x21, 0x21, 
-  0xfd, 0xe2, 0xe3, 0xe5, 0xea, 0xe7, 0xe1, 0xd9, 0xd9, 0xdf, 0xe8, 0xf0, 0xf6, 0xff, 0x08, 0x10, 
-  0x16, 0x1e, 0x22, 0x28, 0x13, 0xed, 0xe6, 0xe8, 0xed, 0xed, 0xe6, 0xde, 0xdc, 0xe2, 0xea, 0xf4, 
-  0xfa, 0x02, 0x0b, 0x13, 0x19, 0x21, 0x26, 0x2d, 0x27, 0xfe, 0xea, 0xeb, 0xed, 0xf1, 0xea, 0xe1, 
-  0xde, 0xe3, 0xea, 0xf4, 0xfc, 0x03, 0x0c, 0x15, 0x1d, 0x24, 0x2a, 0x2e, 0x33, 0x14, 0xf2, 0xef, 
-  0xf0, 0xf5, 0xf2, 0xe7, 0xe1, 0xe4, 0xed, 0xf6, 0xfe, 0x04, 0x0b, 0x13, 0x1b, 0x21, 0x29, 0x2d, 
-  0x34, 0x26, 0xfd, 0xf0, 0xf1, 0xf5, 0xf6, 0xeb, 0xe3, 0xe4, 0xeb, 0xf4, 0xfd, 0x03, 0x0a, 0x12, 
-  0x1a, 0x20, 0x27, 0x2e, 0x35, 0x34, 0x10, 0xf6, 0xf6, 0xf6, 0xfa, 0xf0, 0xe4, 0xe2, 0xe8, 0xf1, 
-  0xfb, 0x02, 0x09, 0x11, 0x19, 0x21, 0x27, 0x2e, 0x34, 0x3a, 0x22, 0xfd, 0xf6, 0xf6, 0xf9, 0xf4, 
-  0xe6, 0xe1, 0xe4, 0xed, 0xf7, 0x00, 0x05, 0x0d, 0x15, 0x1d, 0x23, 0x2a, 0x30, 0x36, 0x2e, 0x07, 
-  0xf4, 0xf4, 0xf7, 0xf5, 0xe4, 0xdb, 0xdc, 0xe4, 0xee, 0xf7, 0xfe, 0x05, 0x0e, 0x16, 0x1d, 0x22, 
-  0x29, 0x2d, 0x2f, 0x11, 0xf2, 0xef, 0xf0, 0xf2, 0xe5, 0xd9, 0xd7, 0xdb, 0xe5, 0xed, 0xf6, 0xfc, 
-  0x04, 0x0d, 0x15, 0x1a, 0x21, 0x26, 0x2c, 0x1c, 0xf6, 0xea, 0xea, 0xed, 0xe6, 0xd6, 0xd4, 0xd8, 
-  0xe1, 0xe8, 0xee, 0xf3, 0xfb, 0x05, 0x0d, 0x13, 0x1a, 0x21, 0x26, 0x22, 0xfe, 0xe6, 0xe5, 0xe6, 
-  0xe4, 0xd4, 0xcf, 0xce, 0xd3, 0xdc, 0xe4, 0xeb, 0xf3, 0xfc, 0x05, 0x0d, 0x12, 0x1a, 0x1e, 0x22, 
-  0x09, 0xe7, 0xe0, 0xdf, 0xdf, 0xd2, 0xc9, 0xcb, 0xd1, 0xdb, 0xe3, 0xeb, 0xf1, 0xf9, 0x02, 0x0a, 
-  0x10, 0x18, 0x1d, 0x23, 0x18, 0xf4, 0xe3, 0xe3, 0xe2, 0xd9, 0xcc, 0xcd, 0xd1, 0xdb, 0xe3, 0xeb, 
-  0xf2, 0xfa, 0x03, 0x0c, 0x13, 0x1a, 0x21, 0x26, 0x25, 0x07, 0xec, 0xe8, 0xe7, 0xe0, 0xd2, 0xcf, 
-  0xd3, 0xdb, 0xe3, 0xea, 0xf0, 0xf6, 0xff, 0x07, 0x10, 0x16, 0x1e, 0x24, 0x28, 0x15, 0xf4, 0xe9, 
-  0xe8, 0xe3, 0xd7, 0xcf, 0xd1, 0xd9, 0xe2, 0xea, 0xf2, 0xf8, 0x01, 0x0a, 0x12, 0x17, 0x1f, 0x25, 
-  0x2a, 0x23, 0x02, 0xee, 0xeb, 0xe6, 0xdc, 0xd2, 0xd3, 0xd9, 0xe2, 0xea, 0xf2, 0xf9, 0x00, 0x09, 
-  0x11, 0x19, 0x1f, 0x26, 0x2c, 0x2d, 0x14, 0xf7, 0xf1, 0xeb, 0xe2, 0xd9, 0xd6, 0xda, 0xe1, 0xe9, 
-  0xf1, 0xf9, 0x00, 0x09, 0x11, 0x1a, 0x20, 0x27, 0x2e, 0x31, 0x24, 0x04, 0xf6, 0xf1, 0xe7, 0xde, 
-  0xd8, 0xdb, 0xe2, 0xe9, 0xf1, 0xf9, 0x01, 0x09, 0x11, 0x19, 0x21, 0x27, 0x2e, 0x32, 0x2e, 0x11, 
-  0xfa, 0xf5, 0xea, 0xe1, 0xda, 0xda, 0xe0, 0xe6, 0xef, 0xf7, 0xff, 0x07, 0x10, 0x18, 0x20, 0x25, 
-  0x2c, 0x32, 0x32, 0x1f, 0x01, 0xf7, 0xed, 0xe4, 0xde, 0xda, 0xdf, 0xe6, 0xee, 0xf6, 0xfe, 0x06, 
-  0x0e, 0x16, 0x1e, 0x24, 0x2b, 0x33, 0x35, 0x2b, 0x0d, 0xfc, 0xf3, 0xe7, 0xe2, 0xdc, 0xde, 0xe4, 
-  0xeb, 0xf3, 0xfa, 0x02, 0x09, 0x11, 0x19, 0x21, 0x27, 0x2e, 0x32, 0x30, 0x19, 0x00, 0xf5, 0xe7, 
-  0xe1, 0xdc, 0xdb, 0xe1, 0xe7, 0xef, 0xf4, 0xfb, 0x02, 0x0a, 0x12, 0x1b, 0x21, 0x29, 0x2f, 0x2e, 
-  0x20, 0x04, 0xf5, 0xe7, 0xde, 0xd9, 0xd5, 0xda, 0xdf, 0xe8, 0xf0, 0xf8, 0xff, 0x06, 0x0d, 0x14, 
-  0x1c, 0x22, 0x2a, 0x2c, 0x24, 0x0a, 0xf5, 0xe8, 0xdb, 0xd8, 0xd3, 0xd5, 0xdb, 0xe2, 0xea, 0xf1, 
-  0xf9, 0xff, 0x06, 0x0d, 0x15, 0x1b, 0x22, 0x27, 0x24, 0x12, 0xf8, 0xe8, 0xdb, 0xd7, 0xd2, 0xcf, 
-  0xd5, 0xdb, 0xe4, 0xeb, 0xf3, 0xfb, 0x02, 0x08, 0x0f, 0x16, 0x1c, 0x23, 0x23, 0x18, 0xff, 0xe9, 
-  0xdb, 0xd4, 0xd1, 0xcc, 0xcf, 0xd5, 0xdc, 0xe4, 0xec, 0xf4, 0xfc, 0x04, 0x0d, 0x15, 0x1b, 0x22, 
-  0x25, 0x1e, 0x0a, 0xef, 0xe0, 0xd7, 0xd3, 0xce, 0xce, 0xd3, 0xda, 0xe3, 0xeb, 0xf4, 0xfc, 0x04, 
-  0x0c, 0x14, 0x1b, 0x22, 0x28, 0x24, 0x16, 0xfb, 0xe6, 0xdd, 0xd7, 0xd3, 0xd0, 0xd5, 0xdc, 0xe4, 
-  0xec, 0xf3, 0xfb, 0x02, 0x0b, 0x12, 0x18, 0x1e, 0x26, 0x25, 0x1c, 0x06, 0xea, 0xdf, 0xd9, 0xd5, 
-  0xd0, 0xd2, 0xda, 0xe1, 0xea, 0xf1, 0xf9, 0x00, 0x09, 0x10, 0x19, 0x1f, 0x26, 0x2a, 0x24, 0x14, 
-  0xf5, 0xe4, 0xdf, 0xd9, 0xd4, 0xd2, 0xd9, 0xe0, 0xe9, 0xf0, 0xf8, 0x00, 0x08, 0x10, 0x18, 0x1f, 
-  0x25, 0x2b, 0x27, 0x1d, 0x02, 0xe8, 0xe4, 0xde, 0xd9, 0xd5, 0xd9, 0xe0, 0xe8, 0xf0, 0xf7, 0x00, 
-  0x07, 0x0f, 0x16, 0x1f, 0x25, 0x2c, 0x2c, 0x24, 0x0f, 0xef, 0xe6, 0xe3, 0xdd, 0xd8, 0xd8, 0xe0, 
-  0xe7, 0xf0, 0xf6, 0xff, 0x06, 0x0e, 0x16, 0x1e, 0x25, 0x2b, 0x30, 0x29, 0x1b, 0xfb, 0xea, 0xe9, 
-  0xe2, 0xdc, 0xd9, 0xdf, 0xe5, 0xee, 0xf5, 0xfc, 0x04, 0x0c, 0x13, 0x1b, 0x23, 0x29, 0x30, 0x2b, 
-  0x21, 0x07, 0xeb, 0xea, 0xe6, 0xdf, 0xd9, 0xdc, 0xe3, 0xea, 0xf2, 0xf9, 0x01, 0x09, 0x12, 0x1a, 
-  0x22, 0x28, 0x2f, 0x30, 0x26, 0x13, 0xf3, 0xeb, 0xeb, 0xe2, 0xdc, 0xdb, 0xe2, 0xe9, 0xf1, 0xf7, 
-  0xff, 0x07, 0x0f, 0x17, 0x1f, 0x25, 0x2b, 0x30, 0x28, 0x19, 0xfc, 0xe9, 0xeb, 0xe5, 0xdd, 0xda, 
-  0xde, 0xe6, 0xee, 0xf4, 0xfb, 0x04, 0x0b, 0x12, 0x18, 0x20, 0x25, 0x2c, 0x28, 0x1c, 0x06, 0xec, 
-  0xea, 0xe9, 0xdf, 0xd9, 0xda, 0xe2, 0xe9, 0xf0, 0xf5, 0xfe, 0x05, 0x0d, 0x15, 0x1d, 0x23, 0x29, 
-  0x2a, 0x1e, 0x0c, 0xf1, 0xe8, 0xeb, 0xe3, 0xd9, 0xd7, 0xdd, 0xe4, 0xeb, 0xf1, 0xf8, 0x01, 0x08, 
-  0x0f, 0x14, 0x1b, 0x20, 0x26, 0x1e, 0x0d, 0xf9, 0xe6, 0xe9, 0xe5, 0xda, 0xd5, 0xd8, 0xe0, 0xe7, 
-  0xee, 0xf4, 0xfd, 0x03, 0x0a, 0x10, 0x18, 0x1d, 0x24, 0x21, 0x10, 0xff, 0xe9, 0xe5, 0xe8, 0xdd, 
-  0xd5, 0xd4, 0xdc, 0xe3, 0xe9, 0xef, 0xf6, 0xfe, 0x05, 0x0b, 0x11, 0x18, 0x1d, 0x21, 0x12, 0x04, 
-  0xf3, 0xe6, 0xec, 0xe5, 0xd9, 0xd5, 0xda, 0xe1, 0xe7, 0xec, 0xf2, 0xfa, 0x01, 0x08, 0x0e, 0x16, 
-  0x1c, 0x21, 0x18, 0x07, 0xfc, 0xea, 0xeb, 0xec, 0xe0, 0xd9, 0xda, 0xe2, 0xe8, 0xee, 0xf3, 0xfb, 
-  0x02, 0x09, 0x0f, 0x16, 0x1c, 0x21, 0x1e, 0x0a, 0x00, 0xf1, 0xe8, 0xee, 0xe5, 0xda, 0xd8, 0xde, 
-  0xe5, 0xeb, 0xf0, 0xf7, 0x00, 0x06, 0x0c, 0x12, 0x1a, 0x1f, 0x20, 0x10, 0x03, 0xfa, 0xec, 0xf1, 
-  0xee, 0xe2, 0xdd, 0xe0, 0xe7, 0xec, 0xf1, 0xf6, 0xfe, 0x04, 0x09, 0x0f, 0x17, 0x1d, 0x21, 0x16, 
-  0x06, 0x01, 0xf1, 0xee, 0xf3, 0xe7, 0xde, 0xdf, 0xe6, 0xeb, 0xf0, 0xf5, 0xfc, 0x04, 0x09, 0x0f, 
-  0x16, 0x1c, 0x21, 0x1c, 0x0a, 0x04, 0xfb, 0xef, 0xf5, 0xf0, 0xe4, 0xe1, 0xe6, 0xec, 0xf1, 0xf6, 
-  0xfc, 0x03, 0x09, 0x0e, 0x14, 0x1b, 0x20, 0x1f, 0x10, 0x07, 0x02, 0xf4, 0xf5, 0xf7, 0xea, 0xe4, 
-  0xe6, 0xec, 0xf1, 0xf6, 0xfc, 0x02, 0x09, 0x0d, 0x12, 0x19, 0x1e, 0x20, 0x14, 0x07, 0x05, 0xfa, 
-  0xf4, 0xfa, 0xf1, 0xe6, 0xe6, 0xeb, 0xf0, 0xf4, 0xf9, 0xff, 0x06, 0x0a, 0x0e, 0x15, 0x1c, 0x1f, 
-  0x19, 0x0b, 0x07, 0x03, 0xf7, 0xfb, 0xf9, 0xec, 0xe8, 0xeb, 0xf0, 0xf4, 0xf9, 0xfe, 0x05, 0x0a, 
-  0x0e, 0x14, 0x1a, 0x1f, 0x1b, 0x0e, 0x06, 0x06, 0xfa, 0xf7, 0xfc, 0xf1, 0xe8, 0xe8, 0xed, 0xf2, 
-  0xf6, 0xfb, 0x02, 0x07, 0x0b, 0x10, 0x17, 0x1c, 0x1a, 0x0f, 0x05, 0x04, 0xfe, 0xf4, 0xfa, 0xf6, 
-  0xea, 0xe7, 0xea, 0xef, 0xf3, 0xf8, 0xfd, 0x04, 0x08, 0x0d, 0x13, 0x19, 0x19, 0x12, 0x07, 0x04, 
-  0x03, 0xf8, 0xf8, 0xfa, 0xed, 0xe7, 0xe8, 0xec, 0xf1, 0xf5, 0xfa, 0xff, 0x04, 0x08, 0x0d, 0x14, 
-  0x17, 0x11, 0x07, 0x01, 0x02, 0xf9, 0xf3, 0xf8, 0xf1, 0xe6, 0xe6, 0xe9, 0xed, 0xf1, 0xf6, 0xfc, 
-  0x01, 0x05, 0x0a, 0x10, 0x15, 0x12, 0x0a, 0x02, 0x01, 0xfe, 0xf3, 0xf6, 0xf6, 0xeb, 0xe6, 0xe7, 
-  0xeb, 0xee, 0xf2, 0xf8, 0xfd, 0x02, 0x06, 0x0c, 0x11, 0x11, 0x0a, 0x02, 0xfe, 0xff, 0xf6, 0xf2, 
-  0xf7, 0xee, 0xe6, 0xe7, 0xea, 0xee, 0xf1, 0xf6, 0xfb, 0x00, 0x03, 0x08, 0x0e, 0x0f, 0x0a, 0x03, 
-  0xfe, 0xff, 0xfb, 0xf2, 0xf7, 0xf4, 0xe9, 0xe7, 0xe9, 0xed, 0xf1, 0xf6, 0xfb, 0x00, 0x04, 0x08, 
-  0x0e, 0x11, 0x0e, 0x08, 0x02, 0x01, 0x01, 0xf7, 0xf6, 0xf8, 0xee, 0xe7, 0xe7, 0xeb, 0xef, 0xf3, 
-  0xf8, 0xfc, 0x00, 0x04, 0x0a, 0x0e, 0x0d, 0x08, 0x02, 0xff, 0x01, 0xfc, 0xf6, 0xfa, 0xf5, 0xec, 
-  0xea, 0xed, 0xf1, 0xf4, 0xf9, 0xfd, 0x02, 0x05, 0x0a, 0x0e, 0x0e, 0x0a, 0x05, 0x01, 0x01, 0x00, 
-  0xf7, 0xf9, 0xf9, 0xf0, 0xeb, 0xec, 0xef, 0xf2, 0xf6, 0xfc, 0x00, 0x04, 0x08, 0x0d, 0x0e, 0x0d, 
-  0x08, 0x04, 0x02, 0x03, 0xfc, 0xf9, 0xfd, 0xf6, 0xee, 0xed, 0xf0, 0xf3, 0xf7, 0xfb, 0x00, 0x05, 
-  0x08, 0x0d, 0x0f, 0x0e, 0x0b, 0x06, 0x03, 0x04, 0x01, 0xfa, 0xfd, 0xfb, 0xf3, 0xef, 0xf1, 0xf4, 
-  0xf7, 0xfb, 0x00, 0x04, 0x08, 0x0c, 0x0f, 0x0f, 0x0e, 0x09, 0x05, 0x05, 0x04, 0xfd, 0xfc, 0xfe, 
-  0xf7, 0xf1, 0xf1, 0xf4, 0xf7, 0xfa, 0xfe, 0x02, 0x06, 0x0a, 0x0d, 0x0d, 0x0d, 0x0a, 0x05, 0x04, 
-  0x05, 0x00, 0xfc, 0xff, 0xfb, 0xf4, 0xf2, 0xf4, 0xf8, 0xfa, 0xfe, 0x02, 0x07, 0x0a, 0x0d, 0x0e, 
-  0x0e, 0x0d, 0x08, 0x05, 0x05, 0x04, 0xfe, 0xfe, 0xfe, 0xf7, 0xf3, 0xf3, 0xf6, 0xf8, 0xfc, 0x00, 
-  0x04, 0x07, 0x0b, 0x0b, 0x0c, 0x0c, 0x08, 0x05, 0x04, 0x05, 0xff, 0xfc, 0xfd, 0xf8, 0xf3, 0xf1, 
-  0xf4, 0xf7, 0xfa, 0xfe, 0x01, 0x04, 0x08, 0x09, 0x09, 0x0b, 0x09, 0x05, 0x04, 0x04, 0x02, 0xfc, 
-  0xfd, 0xfb, 0xf5, 0xf2, 0xf3, 0xf6, 0xf9, 0xfc, 0xff, 0x02, 0x05, 0x07, 0x07, 0x09, 0x08, 0x04, 
-  0x02, 0x01, 0x02, 0xfc, 0xfb, 0xfb, 0xf6, 0xf2, 0xf0, 0xf3, 0xf5, 0xf8, 0xfc, 0xff, 0x03, 0x05, 
-  0x05, 0x06, 0x08, 0x04, 0x01, 0x00, 0x01, 0xff, 0xfb, 0xfc, 0xf8, 0xf3, 0xf1, 0xf2, 0xf4, 0xf7, 
-  0xfb, 0xfe, 0x01, 0x03, 0x03, 0x03, 0x06, 0x04, 0x01, 0x00, 0x00, 0x00, 0xfb, 0xfb, 0xf9, 0xf5, 
-  0xf2, 0xf1, 0xf3, 0xf5, 0xf9, 0xfc, 0xff, 0x02, 0x02, 0x02, 0x05, 0x05, 0x00, 0xff, 0xfe, 0xff, 
-  0xfc, 0xf9, 0xf9, 0xf6, 0xf3, 0xf0, 0xf2, 0xf4, 0xf7, 0xfb, 0xfe, 0x01, 0x02, 0x02, 0x04, 0x07, 
-  0x03, 0x01, 0x00, 0x01, 0x01, 0xfc, 0xfb, 0xf9, 0xf6, 0xf3, 0xf3, 0xf4, 0xf6, 0xf9, 0xfc, 0xff, 
-  0x00, 0x00, 0x01, 0x05, 0x04, 0x00, 0x00, 0xff, 0x01, 0xfd, 0xfb, 0xfa, 0xf8, 0xf5, 0xf4, 0xf5, 
-  0xf7, 0xfa, 0xfd, 0x00, 0x02, 0x01, 0x02, 0x06, 0x07, 0x03, 0x01, 0x01, 0x02, 0x01, 0xfc, 0xfb, 
-  0xf9, 0xf7, 0xf5, 0xf5, 0xf6, 0xf9, 0xfc, 0xfe, 0x01, 0x00, 0x00, 0x04, 0x07, 0x04, 0x02, 0x01, 
-  0x02, 0x03, 0xff, 0xfd, 0xfb, 0xf9, 0xf7, 0xf6, 0xf7, 0xf9, 0xfc, 0xfe, 0x00, 0x01, 0x01, 0x03, 
-  0x07, 0x07, 0x04, 0x03, 0x03, 0x04, 0x02, 0xfe, 0xfc, 0xfa, 0xf9, 0xf7, 0xf7, 0xf9, 0xfb, 0xfe, 
-  0x01, 0x02, 0x01, 0x03, 0x07, 0x09, 0x06, 0x04, 0x04, 0x05, 0x05, 0x01, 0xfe, 0xfc, 0xfb, 0xf9, 
-  0xf8, 0xf9, 0xfb, 0xfe, 0x01, 0x02, 0x01, 0x02, 0x05, 0x08, 0x06, 0x03, 0x04, 0x04, 0x05, 0x02, 
-  0xff, 0xfd, 0xfb, 0xfa, 0xf8, 0xf9, 0xfa, 0xfd, 0x00, 0x02, 0x01, 0x02, 0x05, 0x08, 0x08, 0x05, 
-  0x04, 0x04, 0x05, 0x05, 0x01, 0xfe, 0xfd, 0xfc, 0xfa, 0xf9, 0xfa, 0xfc, 0xff, 0x01, 0x00, 0x00, 
-  0x03, 0x06, 0x08, 0x05, 0x03, 0x04, 0x03, 0x05, 0x02, 0xfe, 0xfd, 0xfc, 0xfa, 0xf8, 0xf9, 0xfa, 
-  0xfd, 0xff, 0x00, 0xff, 0x01, 0x04, 0x07, 0x06, 0x03, 0x03, 0x03, 0x05, 0x04, 0xff, 0xfd, 0xfc, 
-  0xfc, 0xfa, 0xf9, 0xfa, 0xfc, 0xff, 0xff, 0xff, 0x01, 0x03, 0x06, 0x06, 0x03, 0x02, 0x02, 0x02, 
-  0x03, 0xff, 0xfc, 0xfb, 0xfb, 0xfa, 0xf8, 0xf9, 0xfa, 0xfc, 0xfe, 0xfd, 0xfe, 0x00, 0x03, 0x05, 
-  0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0xfc, 0xfa, 0xfa, 0xfa, 0xf9, 0xf9, 0xf9, 0xfc, 0xfd, 0xfc, 
-  0xfd, 0xff, 0x02, 0x05, 0x04, 0x01, 0x01, 0x01, 0x02, 0x02, 0xfd, 0xfa, 0xfa, 0xfa, 0xfa, 0xf8, 
-  0xf9, 0xfa, 0xfc, 0xfc, 0xfc, 0xfe, 0x00, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfa, 
-  0xf9, 0xf9, 0xf9, 0xf8, 0xf8, 0xf9, 0xfb, 0xfb, 0xfa, 0xfc, 0xfe, 0x01, 0x03, 0x02, 0x00, 0x01, 
-  0x00, 0x02, 0x02, 0xfc, 0xfa, 0xfb, 0xfb, 0xfb, 0xf9, 0xfa, 0xfb, 0xfc, 0xfb, 0xfc, 0xfe, 0x00, 
-  0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0xfe, 0xfa, 0xfa, 0xfb, 0xfb, 0xfa, 0xfa, 0xfb, 0xfc, 
-  0xfb, 0xfc, 0xfe, 0x00, 0x03, 0x04, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0xfb, 0xfb, 0xfb, 0xfc, 
-  0xfb, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfd, 0xff, 0x02, 0x04, 0x03, 0x01, 0x02, 0x01, 0x02, 0x03, 
-  0xfd, 0xfb, 0xfc, 0xfc, 0xfc, 0xfb, 0xfa, 0xfb, 0xfb, 0xfb, 0xfd, 0xff, 0x01, 0x03, 0x04, 0x02, 
-  0x02, 0x02, 0x02, 0x04, 0x01, 0xfc, 0xfc, 0xfd, 0xfe, 0xfc, 0xfb, 0xfc, 0xfc, 0xfb, 0xfc, 0xff, 
-  0x01, 0x03, 0x04, 0x03, 0x02, 0x03, 0x03, 0x04, 0x04, 0xfe, 0xfd, 0xfd, 0xfe, 0xfe, 0xfd, 0xfd, 
-  0xfd, 0xfc, 0xfd, 0xff, 0x01, 0x03, 0x05, 0x04, 0x03, 0x03, 0x03, 0x04, 0x05, 0x01, 0xfd, 0xfe, 
-  0xfe, 0xff, 0xfe, 0xfd, 0xfd, 0xfc, 0xfc, 0xfd, 0x00, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 
-  0x05, 0x03, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xfc, 0xfd, 0xff, 0x01, 0x03, 0x04, 
-  0x04, 0x03, 0x03, 0x03, 0x04, 0x04, 0xff, 0xfc, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfc, 0xfb, 0xfc, 
-  0xfd, 0x00, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x02, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 
-  0xfd, 0xfc, 0xfb, 0xfc, 0xfd, 0x00, 0x02, 0x03, 0x04, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0xfd, 
-  0xfc, 0xfd, 0xfd, 0xfe, 0xfd, 0xfc, 0xfa, 0xfa, 0xfb, 0xfd, 0xff, 0x01, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x03, 0xfe, 0xfb, 0xfc, 0xfd, 0xfe, 0xfd, 0xfb, 0xfa, 0xf9, 0xfa, 0xfc, 0xff, 0x01, 
-  0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0xfc, 0xfd, 0xfe, 0xfe, 0xfe, 0xfd, 0xfb, 0xf9, 
-  0xfa, 0xfc, 0xfe, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0xfc, 0xfb, 0xfd, 0xfd, 
-  0xfd, 0xfd, 0xfb, 0xf9, 0xf9, 0xfa, 0xfc, 0xff, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 
-  0xff, 0xfb, 0xfc, 0xfd, 0xfd, 0xfd, 0xfc, 0xfa, 0xf9, 0xfa, 0xfc, 0xfe, 0x00, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x02, 0x01, 0xfc, 0xfc, 0xfd, 0xfd, 0xfe, 0xfd, 0xfa, 0xfa, 0xfa, 0xfc, 0xfe, 
-  0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0xfe, 0xfc, 0xfd, 0xfe, 0xfe, 0xfd, 0xfb, 
-  0xfa, 0xfa, 0xfb, 0xfd, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x00, 0xfc, 0xfd, 
-  0xfe, 0xfe, 0xfe, 0xfc, 0xfa, 0xfa, 0xfb, 0xfc, 0xfe, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x02, 0x02, 0xfd, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xfb, 0xfb, 0xfc, 0xfe, 0x00, 0x01, 0x02, 
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xfb, 0xfb, 0xfc, 
-  0xfe, 0x00, 0x02, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x02, 0xfe, 0xfe, 0x00, 0x00, 0x00, 
-  0xfe, 0xfd, 0xfc, 0xfc, 0xfd, 0xff, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0xff, 
-  0xfe, 0xff, 0x00, 0x00, 0xfe, 0xfd, 0xfc, 0xfc, 0xfe, 0xff, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 
-  0x02, 0x02, 0x03, 0x00, 0xfd, 0xfe, 0x00, 0x00, 0xfe, 0xfd, 0xfc, 0xfb, 0xfc, 0xfd, 0xff, 0x01, 
-  0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0xfd, 0xfc, 
-  0xfc, 0xfd, 0xff, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0xfe, 0xff, 0x00, 
-  0xff, 0xfd, 0xfd, 0xfc, 0xfb, 0xfc, 0xfe, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 
-  0x01, 0xfe, 0xfe, 0x00, 0xff, 0xfd, 0xfd, 0xfc, 0xfb, 0xfc, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x01, 
-  0x01, 0x01, 0x02, 0x02, 0x02, 0xff, 0xfe, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfd, 0xfe, 
-  0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xfc, 0xfd, 
-  0xfc, 0xfb, 0xfc, 0xfd, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0xfe, 0xfe, 
-  0xff, 0xfe, 0xfc, 0xfc, 0xfc, 0xfb, 0xfb, 0xfc, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-  0x01, 0x01, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfd, 0xff, 0x00, 0x00, 
-  0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 
-  0xfd, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 
-  0xfd, 0xfe, 0xfd, 0xfc, 0xfd, 0xfe, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0xff, 
-  0xfe, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xfd, 0xfc, 0xfc, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 
-  0x01, 0x02, 0x01, 0x01, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfd, 0xfe, 0xfd, 0xfd, 0xfd, 0xfe, 0x00, 
-  0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x00, 0xff, 0x00, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 
-  0xfe, 0xfe, 0xff, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x00, 0xff, 0xff, 0xff, 
-  0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 
-  0x01, 0x00, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0x01, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 
-  0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x00, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 
-  0xff, 0xff, 0xfe, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x00, 0xff, 
-  0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 
-  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0x01, 0x00, 
-  0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfe, 
-  0xfe, 0xfe, 0xff, 0x00, 0xff, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0xff, 0xfe, 0xfd, 0xfd, 
-  0xfd, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 
-  0xff, 0xfd, 0xfe, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 
-  0x01, 0x01, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0xff, 0x00, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 
-  0xfe, 0xfe, 0xfe, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0xff, 0xfe, 0xfe, 
-  0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x01, 0x00, 
-  0x00, 0x00, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 
-  0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0xff, 
-  0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x01, 
-  0x01, 0x00, 0x00, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 
-  0x00, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xff, 
-  0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-  0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 
-  0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 
-  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 
-  0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xfe, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x01, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfe, 0xfe, 0xff, 
-  0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-  0x00, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0xff, 0xfe, 
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 
-  0x01, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-  0xff, 0xff, 0xff, 0x00, 0x01, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x01, 0x00, 
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 
-  0x00, 0x01, 0x01, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-  0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-  0x00, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0x00, 0x00, 
-  0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 
-  0xfe, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 
-  0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 
-  0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 
-  0x01, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 
-  0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 
-  0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
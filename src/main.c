@@ -3,7 +3,7 @@ Example of:
   1) using a buffer to store a large RGBA2222 colour bitmap 
   2) load in chunks from file
   3) used buffer commands to split a buffer horizontally
-  4) use screen capture to bitmap function
+  4) animate by moving hardware sprites made of resident bitmaps, a frame per vsync
   5) use transformations to scale and rotate icons
 */
 
@@ -13,11 +13,10 @@ Example of:
 #include <stdlib.h>
 #include <time.h>
 #include <string.h>
+#include <ctype.h>
 #include <agon/vdp.h>
+#include <agon/mos.h>
 #include <agon/timer.h>
-#include "labels.h"
-#include "woosh.h"
-#include "completed.h"
 
 // experimental use of inline escape codes to change text colour
 // all BRIGHT versions of the colour
@@ -29,30 +28,171 @@ Example of:
 #define TEXT_CYAN "\x11\x0E"
 #define TEXT_WHITE "\x11\x0F"
 
+// picture lines read from the SD card at a time
+// buff holds that many lines, then the same again for gathering tile parts
+#define STAGE_LINES 3
+
+// bytes the direct read path reads ahead for small reads, headers and the
+// like - reads of a sector or more go straight to where they are wanted
+#define SECTOR_WINDOW 2048
+
+// eZ80 RAM kept for picture files already read from the SD card, at most
+// four raw pictures or many more compressed ones, less if the heap is
+// short - initRamCache() steps down a raw picture at a time, always
+// leaving RAM_HEADROOM free for stdio and ffs
+#define RAM_CACHE_SIZE 307200
+#define RAM_HEADROOM 16384
+#define MAX_RAM_ENTRIES 32
+
+// icons kept on the eZ80, made as the tiles are loaded, one per tile slot
+#define ICON_STORE 6
+
+// buffers each loader sends a compressed tile into before expanding it
+#define MAIN_TEMP_ID 20
+#define PREFETCH_TEMP_ID 21
+
+// VDU commands built up before they are sent, the longest is a slide program
+#define VDU_BUFF_SIZE 1280
+
+// most puzzles in the folder or pack, and room for all their names
+#define MAX_PUZZLES 512
+#define NAME_POOL_SIZE 12288
+
 // constants used
 const uint8_t  screen_mode = 8;
+const uint8_t  game_mode = 136;       // mode 8 double buffered, for the game screen
 const uint8_t  RGBA2222_format = 1;
-const uint8_t  captureBitmapID = 30;
-const uint16_t startBitmapID = 40;
-const uint16_t startBigBitmapID = 20;
+const uint16_t startBitmapID = 1000;   // tile slots, 16 buffers each
 const uint16_t startIconBitmapID = 100;
 const uint16_t spinIconID = 200;
 const uint16_t transformID = 98;
 const uint16_t spinTransformID = 97;
-const uint16_t tempBigBitmapID = 99;
+const uint16_t previewBitmapID = 99;   // icon blown up to full screen, only while plotting it
 const uint16_t bitmapWidth = 320;
 const uint16_t bitmapHeight = 240;
 const uint16_t chunksPerLine = 4;
 const uint16_t chunkSizeW = 80;
 const uint16_t chunkSizeH = 60;
 const uint16_t label_sprite_start_ID = 0;
-const uint16_t scrollJump = 5;
-const uint16_t scrollSpeed = 8;
+const uint8_t  slideFrames = 10;      // vsyncs per slide, 8 pixels a frame across, 6 down
 const uint16_t numCells = 16;
 const uint16_t hCells = 4;
 const uint16_t vCells = 4;
 const uint16_t numSprites = 8;
-const uint16_t maxPuzzles = 12;
+const uint8_t  stripSpriteID = 8;     // sprites 8-12 carry a sliding line, after the labels
+const uint8_t  stripSprites = 5;      // its 4 tiles and the one wrapping round
+const uint16_t maxPuzzles = MAX_PUZZLES;
+const uint16_t namePoolSize = NAME_POOL_SIZE;
+const uint8_t  iconsPerPage = 12;     // picker grid, 4 x 3
+const uint32_t tileCacheBudget = 6 * 76800;   // VDP memory for tile sets, 76,800 bytes each
+const uint8_t  maxTileSlots = 16;
+const uint8_t  maxRamEntries = MAX_RAM_ENTRIES;
+const uint8_t  iconStoreSize = ICON_STORE;
+const uint16_t noPuzzle = 0xFFFF;
+const uint8_t  noSlot = 255;
+const uint8_t  noCell = 255;
+const uint16_t iconSize = 80*60;
+const char     thumbCacheName[] = "/puzzles/.thumbs";
+const char     thumbCacheTemp[] = "/puzzles/.thumbs.new";   // while compacting it
+const char     thumbCacheMagic[] = "SLTH";
+const uint8_t  thumbCacheVersion = 1;
+const uint8_t  formatRGB2 = 0;        // raw 320x240 RGBA2222
+const uint8_t  formatRGB2Z = 1;       // icon + VDP compressed tiles
+const uint8_t  formatRGB2P = 2;       // palette + 4 or 6 bit pixels
+const uint8_t  formatNone = 255;      // not a puzzle picture
+const char     packName[] = "/puzzles/slider.pak";
+const char     packMagic[] = "SPAK";
+const uint8_t  packVersion = 2;
+const uint16_t sectorSize = 512;
+const char     assetName[] = "/puzzles/slider.dat";   // sounds and labels, see tools/mkassets.py
+const char     assetMagic[] = "SDAT";
+const uint8_t  assetVersion = 2;
+const uint8_t  assetSample = 0;
+const uint8_t  assetBitmap = 1;       // RGBA8888
+const uint8_t  assetAtlas = 2;        // VDP compressed RGBA2222 bitmaps, one above the other
+const uint8_t  assetSampleADPCM = 3;  // 4 bit IMA ADPCM, expanded on the eZ80
+const uint8_t  assetLazy = 1;         // flag: not loaded until needAsset() asks for it
+const uint8_t  maxAssets = 16;
+const uint16_t assetTagID = 300;      // 300+n holds the hash of asset n once it is uploaded
+const uint16_t assetProbeID = 320;    // 320-322 check a tag, 323 marks a match
+const int16_t  adpcmSteps[89] = {
+  7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+  50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+  337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+  2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+  15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767 };
+const int8_t   adpcmIndex[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+const uint16_t atlasID = 330;         // 330 compressed atlas, 331 expanded, only while loading
+const uint16_t cellBufferID = 340;    // 340-355 select the tile in each cell, 356 spare for swaps
+const uint16_t slideProgramID = 360;  // 360-375 the 16 slide animations
+const uint16_t slotTagID = 380;       // 380-395 the stamp of each loaded tile slot
+
+// thumbnail cache record key, followed in the file by the icon data
+typedef struct {
+  char     name[32];
+  uint32_t size;
+  uint32_t stamp;                     // FAT date << 16 | FAT time
+} ThumbKey;
+
+// pack file index entry, see tools/mkpak.py
+typedef struct {
+  char     name[32];
+  uint32_t offset;                    // picture data, from start of the pack
+  uint32_t size;
+  uint32_t iconOffset;                // ready made 80x60 RGBA2222 icon
+} PackEntry;
+
+// asset file index entry
+typedef struct {
+  uint8_t  kind;                      // assetSample, assetBitmap or assetAtlas
+  uint8_t  id;                        // sample number (1 is sample -1) or (first) bitmap number
+  uint8_t  width;
+  uint8_t  height;
+  uint8_t  count;                     // bitmaps in an atlas
+  uint8_t  flags;                     // assetLazy
+  uint8_t  spare[2];
+  uint32_t hash;                      // of the data, so we know if the VDP already has it
+  uint32_t offset;
+  uint32_t size;
+} AssetEntry;
+
+// a picture file held in ramCache
+typedef struct {
+  uint16_t puzzle;
+  uint32_t size;
+  uint16_t lastUsed;                  // for LRU eviction
+  uint8_t  users;                     // loaders reading or filling it, never evicted while > 0
+  bool     complete;                  // whole file is there
+} RamEntry;
+
+// a file read with the ffs_* calls, and where it is, so we only seek when we must
+typedef struct {
+  FIL      fil;
+  uint32_t pos;
+} FfsFile;
+
+// state of a picture being loaded into a tile slot, a step at a time
+typedef struct {
+  FILE     *filePointer;              // stdio path
+  FfsFile  own;                       // direct path, a loose picture file
+  FfsFile  *ffs;                      // own, or packFile which every loader shares
+  bool     direct;                    // reading with ffs_fread
+  bool     fromRam;                   // reading the picture from ramCache, no file open
+  bool     toRam;                     // copying it into ramCache as it is read
+  uint32_t fileStart;                 // file position of the start of the picture
+  uint32_t filePos;                   // where the next read comes from
+  uint32_t bytes;                     // bytes sent to the VDP so far
+  clock_t  readTicks;                 // time spent reading the SD card
+  uint16_t baseID;                    // first of the 16 tile buffers being filled
+  uint16_t tempID;                    // buffer for each compressed tile
+  uint16_t puzzle;
+  uint8_t  format;
+  uint8_t  bpp;                       // 8 for raw, 4 or 6 for palette files
+  uint8_t  step;                      // 16 steps to load a picture
+  uint8_t  icon;                      // storeIcon being made as it loads, noSlot if none
+  bool     reveal;                    // plot each tile as soon as it is made
+  uint8_t  lut[64];                   // palette of a .RGB2P file
+} TileLoader;
 
 
 // for file handling
@@ -61,62 +201,205 @@ FILINFO file;
 
 // some global variables used
 char dirpath[256];
-char myFiles[16][32];
-char fname[32];
+char namePool[NAME_POOL_SIZE];        // puzzle file names, one after another
+uint16_t namePoolUsed = 0;
+uint16_t myNameAt[MAX_PUZZLES];       // where each puzzle's name starts in namePool
 char directoryName[] = "/puzzles/";
-char buff[320*60];
+char buff[2 * STAGE_LINES * 320];     // staging between fread and the VDP
+uint8_t stageLines = STAGE_LINES;     // lines actually used, lowered by the timing test
+char iconBuff[80*60];
 //char bigBuff[320*240];
+uint32_t myFileSize[MAX_PUZZLES];
+uint32_t myFileStamp[MAX_PUZZLES];
+uint32_t myPackOffset[MAX_PUZZLES];
+uint32_t myIconOffset[MAX_PUZZLES];
+FILE *packPointer = NULL;             // slider.pak, kept open while we run
+FfsFile packFile;                     // and for the direct path, opened once
+bool packDirect = false;              // packFile is open
+int16_t iconPage = -1;                // picker page whose icons are in VDP memory
+bool iconReady[12];                   // for each place on that page
 uint8_t arrayBitmaps[4][4];           // which bitmap is in each cell 0-15
 uint8_t arrayOriginal[4][4];           // which bitmap is in each cell 0-15
-uint8_t numPuzzles = 0;
-uint8_t currentPuzzleNum = 0;
+uint8_t arrayShown[4][4];             // which bitmap is on screen in each cell, noCell if not known
+uint16_t numPuzzles = 0;
+uint16_t currentPuzzleNum = 0;
+uint32_t loadBytes = 0;               // bytes sent to the VDP by the last loadBitmaps()
+clock_t loadTicks = 0;                // and how long it took
+clock_t readTicks = 0;                // of which reading the SD card
+uint8_t numTileSlots = 0;             // set from tileCacheBudget
+uint16_t slotPuzzle[16];              // which puzzle is in each tile slot
+bool slotReady[16];                   // and whether it has finished loading
+uint16_t slotLastUsed[16];            // for LRU eviction, 0 = never
+uint32_t slotStamp[16];               // written to its tag buffer when it finished loading
+uint16_t slotLoads = 0;
+uint16_t useCount = 0;
+uint16_t cacheHits = 0;               // swaps that needed no upload
+uint16_t cacheMisses = 0;
+uint8_t currentSlot = 0;              // slot of the puzzle in play
+uint16_t tileBaseID = 0;              // its first tile buffer, used by redrawBitmaps()
+TileLoader mainLoader = { .tempID = MAIN_TEMP_ID };
+TileLoader prefetch = { .tempID = PREFETCH_TEMP_ID };
+bool directReads = true;              // load pictures with ffs_fread, not stdio
+char sectorWindow[SECTOR_WINDOW];     // read ahead of the file being read
+FfsFile *windowOwner = NULL;          // whose file is in sectorWindow
+uint32_t windowStart = 0;             // file position of sectorWindow[0]
+uint16_t windowLen = 0;
+bool ramCacheOn = true;               // off while the timing test measures SD reads
+char *ramCache = NULL;                // picture files, one after another, in ramEntries order
+uint32_t ramCacheBudget = 0;          // its size, set by initRamCache()
+RamEntry ramEntries[MAX_RAM_ENTRIES];
+uint8_t numRamEntries = 0;
+uint32_t ramUsed = 0;
+uint16_t ramUseCount = 0;
+uint16_t ramHits = 0;                 // pictures loaded from ramCache
+uint16_t ramMisses = 0;               // and from the SD card
+char storeIcon[ICON_STORE][80*60];    // icons of pictures whose tiles were loaded
+uint16_t storePuzzle[ICON_STORE];     // whose icon, noPuzzle = empty
+bool storeReady[ICON_STORE];          // and whether it is finished
+uint16_t storeLastUsed[ICON_STORE];   // for LRU eviction
+clock_t slideBegan = 0;               // when the last slide's first frame was due
+clock_t frameBegan = 0;               // and the frame being drawn
+clock_t slideTicks = 0;               // how long the last slide took
+clock_t frameMaxTicks = 0;            // and its longest frame
+uint8_t frameCount = 0;
+char vduBuff[VDU_BUFF_SIZE];          // VDU commands being put together
+uint16_t vduLen = 0;
+uint32_t vduBytes = 0;                // bytes sent by vduFlush()
+uint32_t vduWrites = 0;               // and in how many writes
+uint32_t startBytes = 0;              // what startup sent that way
+uint32_t startWrites = 0;
+uint32_t moveBytes = 0;               // and the last move
+uint32_t moveWrites = 0;
+uint8_t currentMode = 8;              // screen_mode or game_mode
+bool prefetchActive = false;
+uint8_t prefetchSlot = 0;
+bool previewTransformMade = false;    // x4 scale matrix in transformID
+uint32_t assetBytes = 0;              // sound and label bytes sent to the VDP
+clock_t assetTicks = 0;               // time taken by loadAssets() at startup
+clock_t firstPlayTicks = 0;           // time to load the completed sound the first time
+AssetEntry assets[16];                // slider.dat index
+bool assetLoaded[16];
+uint8_t numAssets = 0;
+SYSVAR *sv;
 
 // functions in this file
-void loadBitmaps(char bitmapName[]);
+void loadBitmaps(uint16_t pc);
 uint8_t menuScreen(void);
 void initGame(uint8_t level);
 uint8_t gameScreen(void);
 void completedScreen(void);
 void doExit(void);
 void redrawBitmaps(void);
+void redrawChanged(void);
+void lineShown(bool across, uint8_t line);
+void animateSlide(bool across, uint8_t line, bool back);
+void makeSlidePrograms(void);
+void recordStripStart(bool across, uint8_t line, bool back);
+void recordSlideFrame(bool across, uint8_t line, bool back, uint8_t frame);
+void recordLinePlot(bool across, uint8_t line, bool back);
+uint16_t slidePos(bool across, bool back, uint8_t nn, uint8_t frame);
+void makeStripSprites(void);
+void recordCopy(uint16_t targetID, uint16_t sourceID);
+uint16_t cellID(bool across, uint8_t line, uint8_t nn);
+void writeCells(void);
+void vduByte(uint8_t value);
+void vduWord(uint16_t value);
+void vduFlush(void);
+void vduStore(uint16_t bufferID);
+void vduBufferCmd(uint16_t bufferID, uint8_t command);
+void vduSelect(uint16_t bufferID);
+void vduPlot(uint16_t x, uint16_t y);
+void setMode(uint8_t mode);
+bool waitVDP(void);
+void waitFrame(void);
+void slideStart(void);
+void slideFrame(void);
 void scrollH(uint8_t hNum);
 void scrollV(uint8_t vNum);
 void scrollHrev(uint8_t hNum);
 void scrollVrev(uint8_t vNum);
-void my_vdp_capture_bitmap(uint16_t top, uint16_t left, uint16_t bottom, uint16_t right, uint8_t bitmapID);
-void makeLabel(uint16_t id, char name[],uint16_t xxx, uint16_t yyy );
+void makeLabel(uint16_t id, uint16_t xxx, uint16_t yyy );
 void hideSprites(void);
 void showSprites(void);
 void setupUDG(void);
 void shufflePic(uint8_t level);
 void loadLabels(void);
-uint8_t load_big_puzzles(void);
-void drawRect(uint8_t rectNum);
-uint8_t imagePicker(int8_t curImage);
-void putWord(uint16_t theWord);
-void spinOut(uint8_t icon);
+uint16_t load_big_puzzles(void);
+bool loadThumbCache(uint16_t first, uint16_t last);
+void compactThumbCache(void);
+uint16_t thumbPuzzle(ThumbKey *key);
+bool makeIcon(uint16_t pc);
+void uploadIcon(uint16_t pc);
+void buildIcons(uint16_t page);
+void drawPickerPage(uint16_t page);
+char *puzzleName(uint16_t pc);
+bool addPuzzle(uint16_t pc, char name[]);
+bool validSize(uint8_t format, uint32_t size);
+void plotIcon(uint16_t pc);
+void drawRect(uint16_t rectNum);
+uint16_t imagePicker(uint16_t curImage);
+void spinOut(uint16_t pc);
+void decompressBuffer(uint16_t targetID, uint16_t sourceID);
+uint8_t puzzleFormat(char name[]);
+int8_t findSlot(uint16_t pc);
+uint8_t lruSlot(uint16_t keep[], uint8_t keepCount);
+void initTileCache(void);
+void prefetchStep(uint16_t sel);
+bool loaderOpen(TileLoader *ld, uint16_t pc, bool whole);
+bool loaderStart(TileLoader *ld, uint16_t pc, uint16_t baseID);
+bool loaderStep(TileLoader *ld);
+void loaderCancel(TileLoader *ld);
+void tileReady(TileLoader *ld, uint8_t tile);
+void readLines(TileLoader *ld, uint16_t lines);
+void loaderRead(TileLoader *ld, void *dest, uint16_t len);
+void loaderClose(TileLoader *ld);
+uint32_t benchRead(uint16_t pc, bool direct, clock_t *ticks);
+uint32_t vduLinkTime(uint16_t block);
+void initRamCache(void);
+uint8_t ramFind(uint16_t pc);
+char *ramData(uint8_t n);
+uint8_t ramAdd(uint16_t pc, uint32_t size);
+void ramDrop(uint8_t n);
+uint8_t iconStoreAdd(uint16_t pc);
+uint8_t iconStoreFind(uint16_t pc);
+void shrinkLines(char *icon, uint16_t line, uint16_t lines);
+void drawMenu(void);
+void timingTest(void);
+void showStats(void);
+uint16_t openPack(void);
+FILE *openPuzzle(uint16_t pc);
+void closePuzzle(FILE *filePointer);
+void showPreview(uint16_t pc);
+void loadAssets(void);
+bool tagResident(uint16_t tagID, uint32_t hash);
+void slotLoaded(uint8_t slot);
+void makeSample(uint16_t bufferID);
+void splitBuffer(uint16_t bufferID, uint16_t blockSize, uint16_t targetID);
+bool needAsset(uint8_t kind, uint8_t id);
+void loadAsset(FILE *filePointer, uint8_t n);
+void sendADPCM(FILE *filePointer, uint32_t size, uint16_t bufferID);
 
 // now the main program
 int main(void) {
 
   // setup
+  sv = vdp_vdu_init();              // MOS system variables, for VDP replies
   vdp_mode(screen_mode);            // set to mode 8, 320x240 62 colours
   vdp_cursor_enable(false);         // stop flashing cursor
   vdp_clear_screen();               // clear screen
   vdp_set_pixel_coordinates();      // set to pixel coord format
   vdp_reset_sprites();              // clear any sprites previously on the system
   setupUDG();                       // create UDG chars
+  vdp_set_variable(1,1);            // enable fancy scaling buffer commands, used by spinOut
   srand(time(NULL));                // set random seed
 
-  // load audio samples
+  // load audio samples and label bitmaps from slider.dat
   vdp_audio_enable_channel(3);      // for woosh sound
   vdp_audio_enable_channel(4);      // for completion sound
-  
-  vdp_audio_load_sample( -1, 1971, woosh);  // Load the audio sample
+  loadAssets();
+  makeSlidePrograms();              // every slide's animation, kept on the VDP
   vdp_audio_set_waveform( 3,  -1);          // set sample in bufferID 64256 (-1) to channel 3
-  
-  vdp_audio_load_sample( -2, 14632, completed); // Load the audio sample                               
-  vdp_audio_set_waveform( 4,  -2);              // set sample in bufferID 64255 (-2) to channel 4
+                                            // -2 is loaded by completedScreen() when first needed
       
   numPuzzles = load_big_puzzles();
 
@@ -124,15 +407,15 @@ int main(void) {
     printf("No puzzles found");
     doExit();
   }
-  printf("%d puzzles found",numPuzzles);
+  printf("%u puzzles found",numPuzzles);
 
   // get first default file loaded
-  char thisFile[32];
-  strcpy(thisFile, directoryName);              // directory name 'puzzles/'
-  strcat(thisFile, myFiles[currentPuzzleNum]);  // add current file name
-  strcpy(fname, thisFile);                      // put into fname
-  loadBitmaps(fname);                           // load this bitmap
+  initRamCache();
+  initTileCache();
+  loadBitmaps(currentPuzzleNum);                // load this bitmap
   loadLabels();
+  startBytes = vduBytes;                        // for the timing test
+  startWrites = vduWrites;
 
   // loop whole game here
   while(true) {
@@ -144,9 +427,13 @@ int main(void) {
   return 0;     // exit to MOS
 }
 
-uint8_t load_big_puzzles(void){
+uint16_t load_big_puzzles(void){
   // count number puzzles
-  // load big pics to make icons
+  // icons are made later, when the picker is first opened
+
+  // use the pack file if there is one
+  uint16_t packCount = openPack();
+  if (packCount > 0) return packCount;
 
    // check for folder of puzzle images
   if(ffs_getcwd(dirpath, 256) != 0) {
@@ -160,134 +447,406 @@ uint8_t load_big_puzzles(void){
     return 0;
   }
 
-  uint8_t fileCount=0;
+  // the directory entry has the size, so files are checked without opening them
+  uint16_t fileCount=0;
   while(1) {
     uint8_t result = ffs_dread(&handle, &file); 
     if((result != 0) || (strlen(file.fname) == 0)) break;   // end of list
-    if(fileCount > maxPuzzles) break;                       // we already have enough files
+    if(fileCount >= maxPuzzles) break;                      // we already have enough files
     if(file.fattrib & 0x10) {
       // dir not a file
     }
     else if(file.fname[0]=='.'){
-      // hidden mac file
-    } else {
-      strcpy(myFiles[fileCount], file.fname);             // add this file
+      // hidden mac file, or our own thumbnail cache
+    }
+    else if(!validSize(puzzleFormat(file.fname), file.fsize)){
+      // pack or asset file, or not the right size for a picture
+    }
+    else if(addPuzzle(fileCount, file.fname)) {           // add this file
+      myFileSize[fileCount] = file.fsize;                 // size and date/time are the cache key
+      myFileStamp[fileCount] = ((uint32_t)file.fdate << 16) | file.ftime;
       fileCount++;
     }
-    numPuzzles = fileCount ;
   }
+  ffs_dclose(&handle);
+  numPuzzles = fileCount;
+
+  return numPuzzles;
 
-    
-  vdp_adv_clear_buffer(98);     // clear just in case
+}
 
-  vdp_set_variable(1,1);        // enable fancy scaling buffer commands
+// -----------------------------------------------------------------------
+// puzzle names are kept in one pool rather than a fixed size array each
 
-  // create the transform matrix to be used to scale icon images
-  // this is not in vdp.h yet
+char *puzzleName(uint16_t pc){
+  return namePool + myNameAt[pc];
+}
 
-  // Commands 32 and 33: Create or manipulate a 2D or 3D affine transformation matrix
-  // VDU 23, 0, &A0, bufferId; 32, operation, [<format>, <arguments...>]
+bool addPuzzle(uint16_t pc, char name[]){
+  uint16_t len = strlen(name) + 1;
+  if (len > 32 || namePoolUsed + len > namePoolSize) return false;   // too long, or no room
+  myNameAt[pc] = namePoolUsed;
+  strcpy(namePool + namePoolUsed, name);
+  namePoolUsed += len;
+  return true;
+}
+
+// -----------------------------------------------------------------------
+// is size right for a picture in this format?
+// raw is always 76,800 bytes, a palette file is one of two sizes depending
+// on its bits per pixel, and compressed files have a sensible range
+
+bool validSize(uint8_t format, uint32_t size){
+  if (format == formatRGB2) return size == (uint32_t)bitmapWidth * bitmapHeight;
+  if (format == formatRGB2P) {
+    uint32_t pixels = (uint32_t)bitmapWidth * bitmapHeight;
+    if (size >= 8 + 1 + (pixels / 2) && size <= 8 + 16 + (pixels / 2)) return true;       // 4 bpp
+    return size >= 8 + 17 + (pixels * 3 / 4) && size <= 8 + 64 + (pixels * 3 / 4);       // 6 bpp
+  }
+  if (format == formatRGB2Z) {
+    // header, icon, then 16 tiles of length + at least the 8 byte "CmpT" header,
+    // and at most every byte a 9 bit literal
+    uint32_t tile = (uint32_t)chunkSizeW * chunkSizeH;
+    return size >= 8 + iconSize + (numCells * 10) && size <= 8 + iconSize + (numCells * (10 + (tile * 9 / 8) + 1));
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------
+// pack file - /puzzles/slider.pak, made by tools/mkpak.py
+// 8 byte header "SPAK", version, number of pictures (2 bytes), 1 spare byte
+// then a PackEntry for each picture, then the icons and picture data
+// returns number of pictures, 0 if no usable pack
+
+uint16_t openPack(void){
+  packPointer = fopen(packName, "r");
+  if (packPointer == NULL) return 0;
+
+  char header[8];
+  uint16_t entries = 0;
+  if (fread(header, 1, 8, packPointer) == 8 && memcmp(header, packMagic, 4) == 0
+      && header[4] == packVersion){
+    entries = (uint8_t)header[5] | ((uint8_t)header[6] << 8);
+  }
+
+  uint16_t count = 0;
+  PackEntry entry;
+  for (uint16_t ee = 0; ee < entries && count < maxPuzzles; ee++){
+    if (fread(&entry, 1, sizeof(entry), packPointer) != sizeof(entry)) break;
+    entry.name[31] = 0;
+    if (!validSize(puzzleFormat(entry.name), entry.size)) continue;
+    if (!addPuzzle(count, entry.name)) break;
+    myFileSize[count] = entry.size;
+    myPackOffset[count] = entry.offset;
+    myIconOffset[count] = entry.iconOffset;
+    count++;
+  }
 
-  putchar(23);      // vdu buffer command
-  putchar(0);
-  putchar(0xA0);
+  if (count == 0){
+    fclose(packPointer);
+    packPointer = NULL;
+    return 0;
+  }
+  packDirect = ffs_fopen(&packFile.fil, packName, FA_READ) == 0;
+  packFile.pos = 0;
+  numPuzzles = count;
+  return count;
+}
 
-  putchar(98);      // transform ID word 98
-  putchar(0);
+// -----------------------------------------------------------------------
+// get a file pointer at the start of picture pc
+// either seek in the open pack, or open the loose file
 
-  putchar(32);      // command no 32
+FILE *openPuzzle(uint16_t pc){
+  if (packPointer != NULL){
+    fseek(packPointer, myPackOffset[pc], SEEK_SET);
+    return packPointer;
+  }
 
-  putchar(5);       // operation 5=scale
+  char thisFile[48];
+  strcpy(thisFile, directoryName);              // directory name 'puzzles/'
+  strcat(thisFile, puzzleName(pc));                // add current file name
+  return fopen(thisFile, "r");
+}
 
-  putchar(0x03 | 0x40 | 0x80);    // format fixed point, 16 bit, shift point x 3.
+void closePuzzle(FILE *filePointer){
+  if (filePointer != packPointer) fclose(filePointer);      // pack stays open
+}
 
-  putchar(0x02);       // arguments x scale - should be 1/8 scale
-  putchar(0x00);    // arguments
+// -----------------------------------------------------------------------
+// make the picker icons for one page - only the page being looked at is
+// kept in VDP memory, so this is done again when the page changes
+// each icon is drawn into the grid as soon as it is ready
+
+void buildIcons(uint16_t page){
+  uint16_t first = page * iconsPerPage;
+  uint16_t last = first + iconsPerPage;
+  if (last > numPuzzles) last = numPuzzles;
+
+  iconPage = page;
+  for (uint8_t place = 0; place < iconsPerPage; place++) iconReady[place] = false;
+
+  if (packPointer != NULL){
+    // pack has its icons ready made, so no need for the cache
+    for (uint16_t pc = first; pc < last; pc++){
+      if (makeIcon(pc)) plotIcon(pc);
+    }
+    return;
+  }
 
-  putchar(0x02);    // arguments y scale
-  putchar(0x00);    // arguments
+  // get any icons we made on a previous run
+  bool rewrite = loadThumbCache(first, last);
 
- 
+  FILE *cachePointer = fopen(thumbCacheName, rewrite ? "w" : "a");
+  if (cachePointer != NULL && rewrite) {
+    fwrite(thumbCacheMagic, 1, 4, cachePointer);            // new file, so write the header
+    fputc(thumbCacheVersion, cachePointer);
+    fputc(0, cachePointer);
+    fputc(0, cachePointer);
+    fputc(0, cachePointer);
+  }
 
+  // make icons for any new or changed images
+  for (uint16_t pc = first; pc < last; pc++){
+    if (iconReady[pc % iconsPerPage]) continue;             // already uploaded from the cache
+
+    vdp_cursor_tab(0,29);
+    printf("Scanning: %s             " ,puzzleName(pc));
+    if (makeIcon(pc)) {
+      plotIcon(pc);
+      if (cachePointer != NULL) {
+        ThumbKey key;
+        memset(&key, 0, sizeof(key));
+        strcpy(key.name, puzzleName(pc));
+        key.size = myFileSize[pc];
+        key.stamp = myFileStamp[pc];
+        fwrite(&key, 1, sizeof(key), cachePointer);         // add this icon to the cache
+        fwrite(iconBuff, 1, iconSize, cachePointer);
+      }
+    }
 
-  // iterate through all images
-  for (uint8_t pc=0; pc <numPuzzles ; pc++){
+    vdp_audio_play_note(0,127,400 + ((pc - first) * 24),60);
+  }
 
-  char thisFile[32];
-  strcpy(thisFile, directoryName);              // directory name 'puzzles/'
-  strcat(thisFile, myFiles[pc]);  // add current file name
-  strcpy(fname, thisFile);                      // put into fname
-  // loadBitmaps(fname);                           // load this bitmap
+  if (cachePointer != NULL) fclose(cachePointer);
+}
 
+// -----------------------------------------------------------------------
+// thumbnail cache - /puzzles/.thumbs
+// 8 byte header "SLTH", version, 3 spare bytes
+// then one record per icon: ThumbKey followed by 4800 bytes of RGBA2222
+// new icons are added to the end, and a changed picture's newer record wins
+// over its old one. Once there are a page more records than pictures, some
+// must be stale, so the file is compacted. So is a file ending part way
+// through a record, or everything appended after it would be out of step
+// uploads the icons of puzzles first to last-1 that are in it
+// returns true if the cache is missing or not ours, and needs starting again
+
+bool loadThumbCache(uint16_t first, uint16_t last){
+  FILE *cachePointer = fopen(thumbCacheName, "r");
+  if (cachePointer == NULL) return true;                    // no cache yet
+
+  char header[8];
+  if (fread(header, 1, 8, cachePointer) != 8 || memcmp(header, thumbCacheMagic, 4) != 0
+      || header[4] != thumbCacheVersion){
+    fclose(cachePointer);
+    return true;                                            // not ours, or old version
+  }
 
-    vdp_adv_clear_buffer(tempBigBitmapID);                         // clear the buffer
-    printf("Scanning file %s\r\n", fname); // dir not a file
+  // find where each icon on this page is, just reading the keys
+  uint32_t found[12];
+  for (uint8_t place = 0; place < iconsPerPage; place++) found[place] = 0;
+
+  ThumbKey key;
+  uint32_t pos = 8;
+  uint16_t records = 0;
+  while (fread(&key, 1, sizeof(key), cachePointer) == sizeof(key)){
+    pos += sizeof(key);
+    records++;
+    for (uint16_t pc = first; pc < last; pc++){
+      if (strcmp(key.name, puzzleName(pc)) == 0 && key.size == myFileSize[pc]
+          && key.stamp == myFileStamp[pc]){
+        found[pc - first] = pos;
+        break;
+      }
+    }
+    pos += iconSize;
+    fseek(cachePointer, pos, SEEK_SET);
+  }
+  fseek(cachePointer, 0, SEEK_END);
+  bool torn = (ftell(cachePointer) - 8) % (sizeof(key) + iconSize) != 0;   // last run stopped mid record
+
+  for (uint16_t pc = first; pc < last; pc++){
+    if (found[pc - first] == 0) continue;
+    fseek(cachePointer, found[pc - first], SEEK_SET);
+    if (fread(iconBuff, 1, iconSize, cachePointer) != iconSize) continue;   // truncated record
+    uploadIcon(pc);
+    plotIcon(pc);
+  }
+  fclose(cachePointer);
 
+  if (torn || records > numPuzzles + iconsPerPage) compactThumbCache();
+  return false;
+}
 
+// -----------------------------------------------------------------------
+// copy the thumbnail cache records that still match a picture to a new
+// file, then put it in place of the old one
+
+void compactThumbCache(void){
+  FILE *oldPointer = fopen(thumbCacheName, "r");
+  if (oldPointer == NULL) return;
+  FILE *newPointer = fopen(thumbCacheTemp, "w");
+  if (newPointer == NULL) {
+    fclose(oldPointer);
+    return;
+  }
 
-    FILE *filePointer = fopen(fname, "r");                        // open the RGBA2222 image file
-    uint16_t count = 0;
+  char header[8];
+  fread(header, 1, 8, oldPointer);                          // checked by loadThumbCache()
+  fwrite(header, 1, 8, newPointer);
 
-    if (filePointer == NULL){
-      printf("Error opening file %s\r\n", fname); // dir not a file
+  vdp_cursor_tab(0,29);
+  printf("Tidying icon cache             ");
+  ThumbKey key;
+  uint32_t pos = 8;
+  while (fread(&key, 1, sizeof(key), oldPointer) == sizeof(key)){
+    pos += sizeof(key) + iconSize;
+    if (thumbPuzzle(&key) == noPuzzle) {
+      fseek(oldPointer, pos, SEEK_SET);                     // stale, skip it
+      continue;
     }
-      
-    // load and create big bitmap in small chuncks
+    if (fread(iconBuff, 1, iconSize, oldPointer) != iconSize) break;   // truncated record
+    fwrite(&key, 1, sizeof(key), newPointer);
+    fwrite(iconBuff, 1, iconSize, newPointer);
+  }
+  fclose(oldPointer);
+  fclose(newPointer);
 
-    fread(buff, 1,320*60 ,filePointer);                               // read 80 byte chunk of data from file
-    vdp_adv_write_block_data(tempBigBitmapID, 320*60, buff);        // send chunk into VDP buffer block 20 +
-    fread(buff, 1,320*60 ,filePointer);                               // read 80 byte chunk of data from file
-    vdp_adv_write_block_data(tempBigBitmapID, 320*60, buff);        // send chunk into VDP buffer block 20 +
-    fread(buff, 1,320*60 ,filePointer);                               // read 80 byte chunk of data from file
-    vdp_adv_write_block_data(tempBigBitmapID, 320*60, buff);        // send chunk into VDP buffer block 20 +
-    fread(buff, 1,320*60 ,filePointer);                               // read 80 byte chunk of data from file
-    vdp_adv_write_block_data(tempBigBitmapID, 320*60, buff);        // send chunk into VDP buffer block 20 +
-   
-    vdp_adv_consolidate(tempBigBitmapID);                          // consolidate all uploaded chunks into single buffer
-    vdp_adv_select_bitmap(tempBigBitmapID);                             // select bitmap ID
-    vdp_adv_bitmap_from_buffer(320 , 240, RGBA2222_format);             // make a bitmap 
+  remove(thumbCacheName);
+  rename(thumbCacheTemp, thumbCacheName);
+}
 
-    vdp_adv_select_bitmap(tempBigBitmapID);                        // select bitmap ID      
+// -----------------------------------------------------------------------
+// which puzzle a thumbnail cache record is for, noPuzzle if none now
 
-    fclose(filePointer);    // close the file as we are done with it
+uint16_t thumbPuzzle(ThumbKey *key){
+  for (uint16_t pc = 0; pc < numPuzzles; pc++){
+    if (strcmp(key->name, puzzleName(pc)) == 0 && key->size == myFileSize[pc]
+        && key->stamp == myFileStamp[pc]) return pc;
+  }
+  return noPuzzle;
+}
 
-    // create icon version and store in a buffer
-    // not in vdp.h yet
-    // Command 40: Create a transformed bitmap
-    // VDU 23, 0, &A0, bufferId; 40, options, transformBufferId; sourceBitmapId; [width; height;]
+// -----------------------------------------------------------------------
+// read a big pic and shrink it to an 80x60 icon in iconBuff
+// takes every 4th pixel of every 4th line, same as the old 1/4 scale transform
+// pictures whose tiles have been loaded already have their icon made
+
+bool makeIcon(uint16_t pc){
+  uint8_t stored = iconStoreFind(pc);
+  if (stored != noSlot){
+    memcpy(iconBuff, storeIcon[stored], iconSize);                  // no need to read it again
+    uploadIcon(pc);
+    return true;
+  }
 
-    putch(23);      // vdu buffer command
-    putch(0);
-    putch(0xA0);
+  if (packPointer != NULL){
+    fseek(packPointer, myIconOffset[pc], SEEK_SET);                 // icon is in the pack
+    fread(iconBuff, 1, iconSize, packPointer);
+    uploadIcon(pc);
+    return true;
+  }
 
-    putch(startIconBitmapID + pc);      // minibitmap ID
-    putch(0);       // word
+  static TileLoader ld;                                             // too big for the stack
+  bool whole = puzzleFormat(puzzleName(pc)) != formatRGB2Z;         // .RGB2Z only needs its icon
+  if (!loaderOpen(&ld, pc, whole)) return false;                    // open the image file
 
-    putch(40);      // command
+  if (ld.format == formatRGB2Z) {
+    loaderRead(&ld, iconBuff, iconSize);                            // icon is stored ready made
+    loaderClose(&ld);
+    uploadIcon(pc);
+    return true;
+  }
 
-    putch(1);      // options; resize 1
+  for (uint16_t yy = 0; yy < bitmapHeight; yy++){
+    readLines(&ld, 1);                                              // read a line
+    shrinkLines(iconBuff, yy, 1);
+  }
+  loaderClose(&ld);               // close the file as we are done with it
 
-    putch(98);      // transform matrix buffer ID
-    putch(0);       // word
+  uploadIcon(pc);
+  return true;
+}
 
-    putch(tempBigBitmapID);      // source bitmap ID
-    putch(0);       // word
+// -----------------------------------------------------------------------
+// add the icon of picture lines line to line+lines-1, just read into buff
+
+void shrinkLines(char *icon, uint16_t line, uint16_t lines){
+  for (uint16_t yy = 0; yy < lines; yy++){
+    if (((line + yy) % 4) != 0) continue;
+    char *to = icon + ((line + yy) / 4) * chunkSizeW;
+    char *from = buff + (yy * bitmapWidth);
+    for (uint16_t xx = 0; xx < chunkSizeW; xx++) to[xx] = from[xx * 4];
+  }
+}
 
-    // clear original data as no longer needed
-    vdp_adv_clear_buffer(tempBigBitmapID);                         // clear the buffer
+// -----------------------------------------------------------------------
+// icon store - the icon of each picture loaded into a tile slot is made
+// from the same read, so the picker never has to read it again
+
+uint8_t iconStoreFind(uint16_t pc){
+  for (uint8_t n = 0; n < iconStoreSize; n++){
+    if (storePuzzle[n] == pc && storeReady[n]) {
+      storeLastUsed[n] = ++useCount;
+      return n;
+    }
+  }
+  return noSlot;
+}
 
-        vdp_audio_play_note(0,127,400 + (pc * 24),60);
+// -----------------------------------------------------------------------
+// an entry to make the icon of pc in, reusing the least recently used one
+// returns noSlot if pc's icon is there already, or every entry is being made
+
+uint8_t iconStoreAdd(uint16_t pc){
+  uint8_t best = noSlot;
+  for (uint8_t n = 0; n < iconStoreSize; n++){
+    if (storePuzzle[n] == pc) return noSlot;                 // have it, or being made
+    if (storePuzzle[n] != noPuzzle && !storeReady[n]) continue;
+    if (best == noSlot || storeLastUsed[n] < storeLastUsed[best]) best = n;
   }
+  if (best == noSlot) return noSlot;
 
-  return numPuzzles;
+  storePuzzle[best] = pc;
+  storeReady[best] = false;
+  storeLastUsed[best] = ++useCount;
+  return best;
+}
 
+// -----------------------------------------------------------------------
+// send iconBuff to the VDP as icon bitmap for puzzle pc
+// icons use startIconBitmapID + their place on the picker page
+
+void uploadIcon(uint16_t pc){
+  uint8_t place = pc % iconsPerPage;
+  vdp_adv_clear_buffer(startIconBitmapID + place);                  // clear the buffer
+  vdp_adv_write_block_data(startIconBitmapID + place, iconSize, iconBuff);
+  vdp_adv_select_bitmap(startIconBitmapID + place);                 // select bitmap ID
+  vdp_adv_bitmap_from_buffer(chunkSizeW, chunkSizeH, RGBA2222_format); // make an 80x60 bitmap
+  iconReady[place] = true;
 }
 
-void putWord(uint16_t theWord){
-  uint8_t lsb = theWord %256;
-  uint8_t msb = theWord >> 8;
-  putch(lsb);       // LSB byte
-  putch(msb);       // MSB byte
+// -----------------------------------------------------------------------
+// draw icon pc in its place in the picker grid
+
+void plotIcon(uint16_t pc){
+  uint8_t place = pc % iconsPerPage;
+  uint8_t xpos = place % 4;
+  uint8_t ypos = place / 4;
+
+  vdp_adv_select_bitmap(startIconBitmapID + place);
+  vdp_plot_bitmap(xpos * 80, 24 +(ypos * 60));
 }
 
 
@@ -299,7 +858,185 @@ void putWord(uint16_t theWord){
 
 uint8_t menuScreen(void){
 
+  if (currentMode != screen_mode) setMode(screen_mode);   // back from the game
   hideSprites();
+  drawMenu();
+
+  while(true) {
+    if(vdp_getKeyCode() == 27) doExit();   // exit if ESC pressed
+    if(vdp_getKeyCode() == '1') return 1;   // play level
+    if(vdp_getKeyCode() == '2') return 2;   
+    if(vdp_getKeyCode() == '3') return 3;   
+    if(vdp_getKeyCode() == '4') return 4;   
+    if(vdp_getKeyCode() == '5') return 5;   
+    if(vdp_getKeyCode() == '6') return 6;   
+    if(vdp_getKeyCode() == '7') return 7;   
+    if(vdp_getKeyCode() == '8') return 8;   
+    if(vdp_getKeyCode() == '9') return 9;   
+     if(vdp_getKeyCode() == 's') {
+      currentPuzzleNum = imagePicker(currentPuzzleNum);  
+      vdp_cursor_tab(0,29);
+      printf("Puzzle: %s            " ,puzzleName(currentPuzzleNum));
+      loadBitmaps(currentPuzzleNum);         // reload data
+
+      drawMenu();
+     }
+     if(vdp_getKeyCode() == 't') {          // load timing test
+      timingTest();
+      drawMenu();
+     }
+
+  }
+}
+
+// -----------------------------------------------------------------------
+// what the caches and loads have done so far, the first page of the T test
+
+void showStats(void){
+  vdp_clear_screen();
+  vdp_cursor_tab(0,1);
+  vdp_set_text_colour(BRIGHT_WHITE);
+
+  uint32_t assetSecs = ((uint32_t)assetTicks * 100) / CLOCKS_PER_SEC;
+  uint32_t playSecs = ((uint32_t)firstPlayTicks * 100) / CLOCKS_PER_SEC;
+  printf("Sounds %lub start %lu.%02lus\r\n", assetBytes, assetSecs / 100, assetSecs % 100);
+  printf("Completed sound 1st play %lu.%02lus\r\n\r\n", playSecs / 100, playSecs % 100);
+
+  uint32_t centiSecs = ((uint32_t)loadTicks * 100) / CLOCKS_PER_SEC;
+  uint32_t readSecs = ((uint32_t)readTicks * 100) / CLOCKS_PER_SEC;
+  printf("Last load: %s\r\n", puzzleName(currentPuzzleNum));
+  printf("%lub %lu.%02lus SD %lu.%02lus\r\n\r\n", loadBytes,
+         centiSecs / 100, centiSecs % 100, readSecs / 100, readSecs % 100);
+
+  printf("Tile cache %d slots %u hit %u miss\r\n", numTileSlots, cacheHits, cacheMisses);
+  printf("RAM cache %lu/%luK %u pics\r\n", ramUsed / 1024, ramCacheBudget / 1024, numRamEntries);
+  printf("          %u hit %u miss\r\n\r\n", ramHits, ramMisses);
+
+  uint32_t slideSecs = ((uint32_t)slideTicks * 100) / CLOCKS_PER_SEC;
+  uint32_t frameSecs = ((uint32_t)frameMaxTicks * 100) / CLOCKS_PER_SEC;
+  printf("Last slide %ufr %lu.%02lus max %lu.%02lus\r\n", frameCount,
+         slideSecs / 100, slideSecs % 100, frameSecs / 100, frameSecs % 100);
+  printf("Game screen 2nd buffer %luK\r\n", ((uint32_t)bitmapWidth * bitmapHeight) / 1024);   // one byte a pixel
+
+  printf("\r\nPress any key for read timing");
+  vdp_waitKeyDown();
+  vdp_waitKeyUp();
+}
+
+// -----------------------------------------------------------------------
+// timing test - T on the menu
+// first shows showStats(), then
+// reads every puzzle (up to a page of them) through stdio and then the
+// direct ffs path and shows KB/s for each, then reloads the current puzzle
+// reading 1, 2, 3... lines at a time to compare staging buffer sizes, and
+// times sending VDU bytes a putch each against batched writes
+
+void timingTest(void){
+  showStats();
+
+  vdp_clear_screen();
+  vdp_cursor_tab(0,1);
+  vdp_set_text_colour(BRIGHT_WHITE);
+  printf("Read speed KB/s     stdio   direct\r\n");
+  bool wasCaching = ramCacheOn;
+  ramCacheOn = false;                                       // time the SD card, not RAM
+
+  uint32_t totalBytes = 0;
+  clock_t totalTicks[2] = {0, 0};
+  for (uint16_t pc = 0; pc < numPuzzles && pc < iconsPerPage; pc++){
+    clock_t ticks[2];
+    uint32_t bytes = benchRead(pc, false, &ticks[0]);
+    benchRead(pc, true, &ticks[1]);
+    printf("%-18.18s", puzzleName(pc));
+    for (uint8_t n = 0; n < 2; n++){
+      printf(" %7lu", ticks[n] ? (bytes * CLOCKS_PER_SEC) / ((uint32_t)ticks[n] * 1024) : 0);
+      totalTicks[n] += ticks[n];
+    }
+    printf("\r\n");
+    totalBytes += bytes;
+  }
+  printf("%-18s", "all");
+  for (uint8_t n = 0; n < 2; n++){
+    printf(" %7lu", totalTicks[n] ? (totalBytes * CLOCKS_PER_SEC) / ((uint32_t)totalTicks[n] * 1024) : 0);
+  }
+
+  printf("\r\n\r\nLoad timing: %s\r\n\r\n", puzzleName(currentPuzzleNum));
+
+  for (uint8_t lines = 1; lines <= STAGE_LINES; lines++){
+    stageLines = lines;
+    clock_t startTime = clock();
+    if (loaderStart(&mainLoader, currentPuzzleNum, tileBaseID)) {
+      while (!loaderStep(&mainLoader));
+    }
+    uint32_t centiSecs = ((uint32_t)(clock() - startTime) * 100) / CLOCKS_PER_SEC;
+    uint32_t readSecs = ((uint32_t)mainLoader.readTicks * 100) / CLOCKS_PER_SEC;
+    printf("Staging %4u: %lu.%02lus SD %lu.%02lus\r\n", lines * bitmapWidth * 2,
+           centiSecs / 100, centiSecs % 100, readSecs / 100, readSecs % 100);
+  }
+  stageLines = STAGE_LINES;
+  ramCacheOn = wasCaching;
+
+  // both are held to the serial link's pace, so this is link time a byte,
+  // not what the eZ80 saves by making fewer calls
+  uint32_t perByte = vduLinkTime(0);
+  uint32_t perBlockByte = vduLinkTime(sizeof(vduBuff));
+  printf("\r\nVDU link putch %lu.%luus/b writes %lu.%luus/b\r\n",
+         perByte / 10, perByte % 10, perBlockByte / 10, perBlockByte % 10);
+  printf("Start %lub in %lu writes\r\n", startBytes, startWrites);
+  printf("Move %lub in %lu writes\r\n", moveBytes, moveWrites);
+
+  printf("\r\nPress any key");
+  vdp_waitKeyDown();
+  vdp_waitKeyUp();
+}
+
+// -----------------------------------------------------------------------
+// read the whole of picture pc with loaderRead, nothing sent to the VDP
+// returns the bytes read and how long it took
+
+uint32_t benchRead(uint16_t pc, bool direct, clock_t *ticks){
+  static TileLoader ld;                                     // too big for the stack
+  uint32_t bytes = 0;
+  bool wasDirect = directReads;
+
+  directReads = direct;
+  clock_t startTime = clock();
+  if (loaderOpen(&ld, pc, false)) {                        // timing the card, not the cache
+    uint32_t end = ((packPointer != NULL) ? myPackOffset[pc] : 0) + myFileSize[pc];
+    while (ld.filePos < end){                               // header is already read
+      uint32_t left = end - ld.filePos;
+      loaderRead(&ld, buff, (left > sizeof(buff)) ? sizeof(buff) : left);
+    }
+    loaderClose(&ld);
+    bytes = myFileSize[pc];
+  }
+  *ticks = clock() - startTime;
+  directReads = wasDirect;
+  return bytes;
+}
+
+// -----------------------------------------------------------------------
+// tenths of a microsecond a byte to send VDU 0s (ignored by the VDP) a
+// putch each if block is 0, otherwise in mos_puts writes of block bytes
+
+uint32_t vduLinkTime(uint16_t block){
+  const uint32_t count = 32768;
+  memset(vduBuff, 0, sizeof(vduBuff));
+
+  clock_t startTime = clock();
+  if (block == 0) {
+    for (uint32_t n = 0; n < count; n++) putch(0);
+  } else {
+    for (uint32_t n = 0; n < count; n += block) mos_puts(vduBuff, block, 0);
+  }
+  return ((uint32_t)(clock() - startTime) * (10000000 / CLOCKS_PER_SEC)) / count;
+}
+
+// -----------------------------------------------------------------------
+// draw the menu text
+
+void drawMenu(void){
+
   vdp_clear_screen();
   vdp_cursor_tab(0,1);
   vdp_set_text_colour(BRIGHT_RED);
@@ -330,81 +1067,9 @@ uint8_t menuScreen(void){
 
   vdp_set_text_colour(BRIGHT_BLACK);
   vdp_cursor_tab(8,29);
-  //printf("Puzzle: %s             " ,myFiles[currentPuzzleNum]);
+  //printf("Puzzle: %s             " ,puzzleName(currentPuzzleNum));
   printf("\xA9 Richard Turnnidge 2025");  // \u00A9 is ©
   vdp_set_text_colour(BRIGHT_WHITE); 
-
-  while(true) {
-    if(vdp_getKeyCode() == 27) doExit();   // exit if ESC pressed
-    if(vdp_getKeyCode() == '1') return 1;   // play level
-    if(vdp_getKeyCode() == '2') return 2;   
-    if(vdp_getKeyCode() == '3') return 3;   
-    if(vdp_getKeyCode() == '4') return 4;   
-    if(vdp_getKeyCode() == '5') return 5;   
-    if(vdp_getKeyCode() == '6') return 6;   
-    if(vdp_getKeyCode() == '7') return 7;   
-    if(vdp_getKeyCode() == '8') return 8;   
-    if(vdp_getKeyCode() == '9') return 9;   
-    // if(vdp_getKeyCode() == 's') {           // find next bitmap file
-    //   char thisFile[32];
-    //   currentPuzzleNum ++;
-    //   if (currentPuzzleNum > numPuzzles-1) currentPuzzleNum = 0;
-    //   strcpy(thisFile, directoryName);
-    //   strcat(thisFile, myFiles[currentPuzzleNum]);
-    //   strcpy(fname, thisFile);
-    //   vdp_cursor_tab(0,29);
-    //   printf("Puzzle: %s            " ,myFiles[currentPuzzleNum]);
-    //   loadBitmaps(fname);         // reload data
-    //   vdp_waitKeyUp();
-    // };   
-     if(vdp_getKeyCode() == 's') {
-      char thisFile[32];
-      currentPuzzleNum = imagePicker(currentPuzzleNum);  
-      strcpy(thisFile, directoryName);
-      strcat(thisFile, myFiles[currentPuzzleNum]);
-      strcpy(fname, thisFile);
-      vdp_cursor_tab(0,29);
-      printf("Puzzle: %s            " ,myFiles[currentPuzzleNum]);
-      loadBitmaps(fname);         // reload data
-
-      vdp_clear_screen();
-
-      vdp_cursor_tab(0,1);
-      vdp_set_text_colour(BRIGHT_RED);
-      printf("            S L I D E R\n\n\n");
-      vdp_set_text_colour(BRIGHT_WHITE);
-      printf("     Press:");
-      vdp_set_text_colour(BRIGHT_YELLOW);
-      printf(" 1 - 9 for level\n\n");
-      printf("            S to Swap puzzle\n\n");
-
-      vdp_set_text_colour(BRIGHT_WHITE);
-      printf("   In game: ");
-      vdp_set_text_colour(BRIGHT_YELLOW);
-      printf("Q to Give up\n\n");
-      printf("            ESC to exit program\n\n");
-      printf("            1-4 & A-B to scroll\n\n");
-      printf("            SHIFT reverse direction\n\n");
-
-      vdp_cursor_tab(0,17);
-
-      // experimental inline text colour change
-      printf("             " TEXT_CYAN "  1 2 3 4\n");
-      printf("             " TEXT_CYAN "  %c %c %c %c \n\n", 129, 129, 129, 129);
-      printf("            " TEXT_CYAN "A%c " TEXT_BLUE "X X X X\n\n", 128);
-      printf("            " TEXT_CYAN "B%c " TEXT_BLUE "X X X X\n\n", 128);
-      printf("            " TEXT_CYAN "C%c " TEXT_BLUE "X X X X\n\n", 128);
-      printf("            " TEXT_CYAN "D%c " TEXT_BLUE "X X X X\n\n", 128);
-
-      vdp_cursor_tab(8,29);
-      vdp_set_text_colour(BRIGHT_BLACK); 
-            //printf("Puzzle: %s             " ,myFiles[currentPuzzleNum]);
-      printf("\xA9 Richard Turnnidge 2025");  // \u00A9 is ©
-      vdp_set_text_colour(BRIGHT_WHITE); 
-
-     }
-
-  }
 }
 
 // -----------------------------------------------------------------------
@@ -413,55 +1078,56 @@ uint8_t menuScreen(void){
 //
 // -----------------------------------------------------------------------
 
-uint8_t imagePicker(int8_t curImage){
+uint16_t imagePicker(uint16_t curImage){
   // arrive with current image number highlighted
   hideSprites();
-  vdp_clear_screen();
-  vdp_cursor_tab(0,1);
-  vdp_set_text_colour(BRIGHT_WHITE);
-  printf("Select Picture %c %c then ENTER\n\n", 130, 131);
-
-  // draw thumbnails
-  for (uint8_t xx = 0; xx < numPuzzles ; xx++){
-      uint8_t xpos = xx % 4;
-      uint8_t ypos = xx / 4;
-
-      vdp_adv_select_bitmap(startIconBitmapID + xx);
-      vdp_plot_bitmap(xpos * 80, 24 +(ypos * 60));
-
-  }
+  uint16_t page = curImage / iconsPerPage;
+  drawPickerPage(page);
   drawRect(curImage);
   vdp_cursor_tab(0,29);
-  printf("Puzzle: %s             " ,myFiles[curImage]);
+  printf("Puzzle: %s             " ,puzzleName(curImage));
   while(true) {
 
     if(vdp_getKeyCode() == 27) doExit();   // exit if ESC pressed
+    uint16_t oldImage = curImage;
+    uint8_t key = vdp_getKeyCode();
     if(vdp_getKeyCode() == 8) {         // prev image
         vdp_audio_play_note(0,127,500,50);
-        curImage --;
-        if (curImage < 0) curImage = numPuzzles -1;
-        drawRect(curImage);
-          vdp_set_text_colour(BRIGHT_WHITE);
-          vdp_cursor_tab(0,29);
-          printf("Puzzle: %s             " ,myFiles[curImage]);
-        vdp_waitKeyUp();
+        curImage = (curImage == 0) ? numPuzzles - 1 : curImage - 1;
     }
     if(vdp_getKeyCode() == 21) {         // next image
       vdp_audio_play_note(0,127,600,50);
-        curImage ++;
-        if (curImage > numPuzzles -1) curImage = 0;
+        curImage = (curImage == numPuzzles - 1) ? 0 : curImage + 1;
+    }
+    if(vdp_getKeyCode() == 11) {         // prev page
+      vdp_audio_play_note(0,127,500,50);
+        if (curImage >= iconsPerPage) curImage -= iconsPerPage;
+        else curImage = numPuzzles - 1;
+    }
+    if(vdp_getKeyCode() == 10) {         // next page
+      vdp_audio_play_note(0,127,600,50);
+        if (curImage / iconsPerPage == (numPuzzles - 1) / iconsPerPage) curImage = 0;
+        else if (curImage + iconsPerPage < numPuzzles) curImage += iconsPerPage;
+        else curImage = numPuzzles - 1;
+    }
+    if (curImage != oldImage) {
+        if (curImage / iconsPerPage != page) {
+          page = curImage / iconsPerPage;
+          drawPickerPage(page);                 // only this page's icons are loaded
+        }
         drawRect(curImage);
           vdp_set_text_colour(BRIGHT_WHITE);
           vdp_cursor_tab(0,29);
-          printf("Puzzle: %s             " ,myFiles[curImage]);
-         vdp_waitKeyUp();
+          printf("Puzzle: %s             " ,puzzleName(curImage));
     }
+    if (key == 8 || key == 21 || key == 11 || key == 10) vdp_waitKeyUp();   // even if it went nowhere
     //vdp_cursor_tab(0,10);
     //printf("code=%d   ",vdp_getKeyCode());
     if(vdp_getKeyCode() == 13) {
       vdp_audio_play_note(0,127,800,80);
       break;        // ENTER
     }
+    if(vdp_getKeyCode() == 0) prefetchStep(curImage);   // nothing pressed, so load ahead
   }
 
   spinOut(curImage);
@@ -469,16 +1135,41 @@ uint8_t imagePicker(int8_t curImage){
 
 }
 
+// -----------------------------------------------------------------------
+// clear the screen and draw one page of icons, making any we don't have yet
+
+void drawPickerPage(uint16_t page){
+  uint16_t pages = (numPuzzles + iconsPerPage - 1) / iconsPerPage;
+
+  vdp_clear_screen();
+  vdp_cursor_tab(0,1);
+  vdp_set_text_colour(BRIGHT_WHITE);
+  printf("Select Picture %c %c then ENTER\n\n", 130, 131);
+  if (pages > 1) {
+    vdp_cursor_tab(0,27);
+    printf("Page %u of %u, up/down for more", page + 1, pages);
+  }
+
+  if (iconPage == page) {
+    uint16_t first = page * iconsPerPage;
+    for (uint16_t pc = first; pc < first + iconsPerPage && pc < numPuzzles; pc++){
+      if (iconReady[pc - first]) plotIcon(pc);
+    }
+  } else {
+    buildIcons(page);
+  }
+}
+
 // -----------------------------------------------------------------------
 // just draw the rectangles around the icons
 
-void drawRect(uint8_t rectNum){
+void drawRect(uint16_t rectNum){
   uint8_t xpos ;
   uint8_t ypos ;
 
   // clear old rect
   vdp_set_graphics_fg_colour(0,0);
-  for (uint8_t xx = 0; xx < numPuzzles ; xx++){
+  for (uint8_t xx = 0; xx < iconsPerPage ; xx++){
     xpos = xx % 4;
     ypos = xx / 4;
     vdp_rectangle( xpos * 80 ,24 +(ypos * 60), (xpos * 80 ) + 80 , 60 + 24 +(ypos * 60));
@@ -486,8 +1177,8 @@ void drawRect(uint8_t rectNum){
   }
   //plot new single rect
   vdp_set_graphics_fg_colour(0,BRIGHT_RED);
-  xpos = rectNum % 4;
-  ypos = rectNum / 4;
+  xpos = (rectNum % iconsPerPage) % 4;
+  ypos = (rectNum % iconsPerPage) / 4;
   vdp_rectangle( (xpos * 80) + 1 ,24 -1 +(ypos * 60), (xpos * 80) - 1 + 80 , 60 + 24 -1  +(ypos * 60));
   vdp_rectangle( (xpos * 80)  ,24  +(ypos * 60), (xpos * 80)  + 80 , 60 + 24   +(ypos * 60));
 
@@ -496,7 +1187,8 @@ void drawRect(uint8_t rectNum){
 // -----------------------------------------------------------------------
 // spin out selected icon
 
-void spinOut(uint8_t icon){
+void spinOut(uint16_t pc){
+  uint8_t icon = pc % iconsPerPage;         // place on the picker page
 
   uint16_t startX = icon % 4;
   uint16_t startY = icon / 4;
@@ -507,86 +1199,53 @@ void spinOut(uint8_t icon){
   for(uint8_t n=1; n<10; n++){              // spin out here
 
     vdp_adv_clear_buffer(spinIconID);         // clear the transform buffer
-    vdp_adv_clear_buffer(97);         // clear the transform buffer
+    vdp_adv_clear_buffer(spinTransformID);         // clear the transform buffer
 
 
         // create spinout transformation- part 1: rotation
 // Commands 32 and 33: Create or manipulate a 2D or 3D affine transformation matrix
   // VDU 23, 0, &A0, bufferId; 32, operation, [<format>, <arguments...>]
 
-  putchar(23);      // vdu buffer command
-  putchar(0);
-  putchar(0xA0);
-
-  putchar(97);      // transform ID word 97 spinout
-  putchar(0);
-
-  putchar(32);      // command no 32
+  vduBufferCmd(spinTransformID, 32);      // transform ID word 97 spinout, command no 32
 
-  putchar(2);       // operation 3=rotate rads 2=deg
+  vduByte(2);       // operation 3=rotate rads 2=deg
 
-  putchar(0x00 | 0x40 | 0x80);    // format fixed point, 16 bit, shift point x 0.
+  vduByte(0x00 | 0x40 | 0x80);    // format fixed point, 16 bit, shift point x 0.
 
-  uint8_t a = (n * 40) % 256;   // try to do 1 full rotation
-  uint8_t b = (n * 40) / 256;
-
-  putchar(a);       // arguments angle 1 deg
-  putchar(b);    // arguments
+  vduWord(n * 40);  // arguments angle, try to do 1 full rotation
 
 
   // create spinout transformation- part 2: scale
   // Commands 32 and 33: Create or manipulate a 2D or 3D affine transformation matrix
     // VDU 23, 0, &A0, bufferId; 32, operation, [<format>, <arguments...>]
 
-    putchar(23);      // vdu buffer command
-    putchar(0);
-    putchar(0xA0);
-
-    putchar(97);      // transform ID word 98
-    putchar(0);
-
-    putchar(32);      // command no 32
-
-    putchar(5);       // operation 5=scale
-
-    putchar(0x02 | 0x40 | 0x80);    // format fixed point, 16 bit, shift point x 1.
-
-    putchar(n + 3);       // arguments x scale - should be 1.5 x n
-    putchar(0x00);    // arguments
-
-    putchar(n +3);    // arguments y scale
-    putchar(0x00);    // arguments
-
+    vduBufferCmd(spinTransformID, 32);    // transform ID word 97, command no 32
 
+    vduByte(5);       // operation 5=scale
 
+    vduByte(0x02 | 0x40 | 0x80);    // format fixed point, 16 bit, shift point x 1.
 
+    vduWord(n + 3);   // arguments x scale - should be 1.5 x n
 
+    vduWord(n + 3);   // arguments y scale
 
 
     // create the bitmap
+  // Command 40: Create a transformed bitmap
+  // VDU 23, 0, &A0, bufferId; 40, options, transformBufferId; sourceBitmapId; [width; height;]
 
-  putch(23);      // vdu buffer command
-  putch(0);
-  putch(0xA0);
+  vduBufferCmd(spinIconID, 40);   // minibitmap ID, command
 
-  putch(spinIconID);      // minibitmap ID
-  putch(0);       // word
+  vduByte(5);      // options; resize 1
 
-  putch(40);      // command
+  vduWord(spinTransformID);       // transform matrix buffer ID
 
-  putch(5);      // options; resize 1
+  vduWord(startIconBitmapID + icon);      // source bitmap ID
 
-  putch(97);      // transform matrix buffer ID
-  putch(0);       // word
+  // vduWord(80 + (n * 20));      // x size
+  // vduWord(60 + (n * 20));      // y size
 
-  putch(startIconBitmapID + icon);      // source bitmap ID
-  putch(0);       // word
-
-  // putch(80 + (n * 20));      // x size
-  // putch(0);       // word
-
-  // putch(60 + (n * 20));      // y size
-  // putch(0);       // word
+  vduFlush();       // the matrices and the bitmap in one write
 
 
   vdp_adv_select_bitmap(spinIconID);
@@ -628,11 +1287,13 @@ void initGame(uint8_t level){
     }
   }
 
-  vdp_clear_screen();                     // clear screen
-  redrawBitmaps();                        // show current bitmap
+  setMode(game_mode);                     // double buffered, clear screen
+  redrawBitmaps();                        // show current bitmap, in both buffers
+  makeStripSprites();                     // with this puzzle's tiles
+  writeCells();                           // tell the slide programs where each tile is
   shufflePic(level);                      // ix up 'level' times
   vdp_refresh_sprites();                  // put controls in corrrect psition
-  vdp_activate_sprites(numSprites);       // activate control sprites
+  vdp_activate_sprites(numSprites + stripSprites);   // activate control and strip sprites
   showSprites();                          // display controls
 }
 
@@ -648,6 +1309,8 @@ uint8_t gameScreen(void){
 
     vdp_waitKeyDown();  // wait until something is pressed, then check what
     uint8_t kCode = vdp_getKeyCode();   // get code of key just pressed
+    uint32_t bytesBefore = vduBytes;
+    uint32_t writesBefore = vduWrites;
 
     if(kCode == 'a') scrollH(0);   // scroll a line
     if(kCode == 'b') scrollH(1);   // scroll a line
@@ -671,6 +1334,11 @@ uint8_t gameScreen(void){
     if(kCode == '#') scrollVrev(2);   // scroll a column
     if(kCode == '$') scrollVrev(3);   // scroll a column
 
+    if (vduWrites != writesBefore) {    // a move, for the timing test
+      moveBytes = vduBytes - bytesBefore;
+      moveWrites = vduWrites - writesBefore;
+    }
+
     if(kCode == 27) doExit();   // exit if ESC pressed
     if(kCode == 'q') return 0;   // end game, go to menu screen
 
@@ -704,7 +1372,13 @@ void completedScreen(void){
   printf("+                 +\n");
   vdp_cursor_tab(10,24);
   printf("+++++++++++++++++++\n");
+  waitFrame();                          // flip it into view
 
+  clock_t startTime = clock();
+  if (needAsset(assetSample, 2)) {
+    vdp_audio_set_waveform( 4,  -2);    // set sample in bufferID 64255 (-2) to channel 4
+    firstPlayTicks = clock() - startTime;
+  }
   vdp_audio_play_sample(4,127);         // completed cound
 
   vdp_waitKeyDown();                    // wait for key down/up to continue
@@ -755,64 +1429,12 @@ void shufflePic(uint8_t level){
   }
 }
 
-// -----------------------------------------------------------------------
-// capture screen area and stores in a bitmap
-// horizontal capture
-
-void captureBitmapH(uint8_t hNum){
-  uint16_t topPos = hNum * chunkSizeH;
-  uint16_t bottomPos = ((hNum + 1) * chunkSizeH) - 1;
-  
-  my_vdp_capture_bitmap(topPos,0,bottomPos, 319,captureBitmapID );                 // capture image
-}
-
-// -----------------------------------------------------------------------
-// vertical capture
-
-void captureBitmapV(uint8_t vNum){
-  uint16_t leftPos = vNum * chunkSizeW;
-  uint16_t rightPos = ((vNum + 1) * chunkSizeW) - 1;
-  
-  my_vdp_capture_bitmap(0, leftPos, 239,rightPos, captureBitmapID );                 // capture image
-}
-
-// -----------------------------------------------------------------------
-
-void my_vdp_capture_bitmap(uint16_t top, uint16_t left, uint16_t bottom, uint16_t right, uint8_t bmID){
-
-  vdp_move_to( left, top );            // define top left point
-  vdp_move_to( right, bottom );         // define bottom right point
-  
-  // VDU 23, 27, 1, n, 0, 0;: Capture screen data into bitmap n *
-  // not yet defined in vdp.h so do it with putch()
-
-  putch(23);
-  putch(27);
-  putch(1);
-  putch(bmID);           // defined as constant
-  putch(0);
-  putch(0);
-  putch(0);
-}
-
 // -----------------------------------------------------------------------
 
 void scrollH(uint8_t hNum){
   vdp_waitKeyUp();
 
- // capture bitmap
-  captureBitmapH( hNum);
-  vdp_select_bitmap(captureBitmapID);
-
-// play sound
-  vdp_audio_play_sample(3,127);
- 
-// animate bitmap
-  for (uint16_t xx = 0; xx <= chunkSizeW ; xx += scrollJump){
-      vdp_plot_bitmap( xx , hNum * chunkSizeH);          // plot the bitmap at 0,0
-      vdp_plot_bitmap( xx - bitmapWidth , hNum * chunkSizeH);          // plot the bitmap at 0,0
-      delay(scrollSpeed);
-  }
+  animateSlide(true, hNum, false);      // slide the line a cell
 
   // grab id of each bitmap in row and transfer to next position
   // we get column number from 0-3
@@ -821,7 +1443,8 @@ void scrollH(uint8_t hNum){
   arrayBitmaps[2][hNum] = arrayBitmaps[1][hNum];
   arrayBitmaps[1][hNum] = arrayBitmaps[0][hNum];
   arrayBitmaps[0][hNum] = temp;
-  redrawBitmaps();
+  lineShown(true, hNum);                // last frame drew it all
+  redrawChanged();
 
 }
 // -----------------------------------------------------------------------
@@ -829,19 +1452,7 @@ void scrollH(uint8_t hNum){
 void scrollHrev(uint8_t hNum){
   vdp_waitKeyUp();
 
- // capture bitmap
-  captureBitmapH( hNum);
-  vdp_select_bitmap(captureBitmapID);
-
-// play sound
-  vdp_audio_play_sample(3,127);
- 
-// animate bitmap
-  for (uint16_t xx = 0; xx <= chunkSizeW ; xx += scrollJump){
-      vdp_plot_bitmap( 0 - xx , hNum * chunkSizeH);          // plot the bitmap at 0,0
-      vdp_plot_bitmap( 320 -xx , hNum * chunkSizeH);          // plot the bitmap at 0,0
-      delay(scrollSpeed);
-  }
+  animateSlide(true, hNum, true);       // slide the line a cell
 
   // grab id of each bitmap in row and transfer to next position
   // we get column number from 0-3
@@ -850,7 +1461,8 @@ void scrollHrev(uint8_t hNum){
   arrayBitmaps[1][hNum] = arrayBitmaps[2][hNum];
   arrayBitmaps[2][hNum] = arrayBitmaps[3][hNum];
   arrayBitmaps[3][hNum] = temp;
-  redrawBitmaps();
+  lineShown(true, hNum);                // last frame drew it all
+  redrawChanged();
 
 }
 
@@ -859,19 +1471,7 @@ void scrollHrev(uint8_t hNum){
 void scrollV(uint8_t vNum){
   vdp_waitKeyUp();
 
-   // capture bitmap
-  captureBitmapV( vNum);
-  vdp_select_bitmap(captureBitmapID);
-
-  // play sound
-  vdp_audio_play_sample(3,127);
-
-// animate bitmap
-  for (uint16_t yy = 0; yy <= chunkSizeH ; yy += scrollJump){
-      vdp_plot_bitmap(vNum * chunkSizeW,  yy );          // plot the bitmap at 0,0
-      vdp_plot_bitmap(vNum * chunkSizeW,  yy - bitmapHeight );          // plot the bitmap at 0,0
-      delay(scrollSpeed);
-  }
+  animateSlide(false, vNum, false);     // slide the line a cell
 
   // grab id of each itmap in row and transfer to next position
   // we get row number from 0-3
@@ -881,7 +1481,8 @@ void scrollV(uint8_t vNum){
   arrayBitmaps[vNum][2] = arrayBitmaps[vNum][1];
   arrayBitmaps[vNum][1] = arrayBitmaps[vNum][0];
   arrayBitmaps[vNum][0] = temp;
-  redrawBitmaps();
+  lineShown(false, vNum);               // last frame drew it all
+  redrawChanged();
 
 }
 
@@ -890,19 +1491,7 @@ void scrollV(uint8_t vNum){
 void scrollVrev(uint8_t vNum){
   vdp_waitKeyUp();
 
-   // capture bitmap
-  captureBitmapV( vNum);
-  vdp_select_bitmap(captureBitmapID);
-
-  // play sound
-  vdp_audio_play_sample(3,127);
-
-// animate bitmap
-  for (uint16_t yy = 0; yy <= chunkSizeH ; yy += scrollJump){
-      vdp_plot_bitmap(vNum * chunkSizeW,  0 - yy );          // plot the bitmap at 0,0
-      vdp_plot_bitmap(vNum * chunkSizeW,  240 - yy );          // plot the bitmap at 0,0
-      delay(scrollSpeed);
-  }
+  animateSlide(false, vNum, true);      // slide the line a cell
 
   // grab id of each itmap in row and transfer to next position
   // we get row number from 0-3
@@ -912,78 +1501,907 @@ void scrollVrev(uint8_t vNum){
   arrayBitmaps[vNum][1] = arrayBitmaps[vNum][2];
   arrayBitmaps[vNum][2] = arrayBitmaps[vNum][3];
   arrayBitmaps[vNum][3] = temp;
-  redrawBitmaps();
+  lineShown(false, vNum);               // last frame drew it all
+  redrawChanged();
 
 }
 
 // -----------------------------------------------------------------------
-// pre-load all the bitmap data needed and create bitmap buffers
-
-void loadBitmaps(char bitmapName[])
-{
-  for (uint16_t bitmapNum = 0; bitmapNum < 24 ; bitmapNum++){
-    vdp_adv_clear_buffer(startBigBitmapID + bitmapNum);                         // clear all buffers
+// slide a row (across) or column one cell right or down, or left or up if
+// back - the whole animation is one of the programs made by
+// makeSlidePrograms(), so all we send is the call
+// not in vdp.h yet
+// VDU 23, 0, &A0, bufferId; 1: Call a buffer
+
+void animateSlide(bool across, uint8_t line, bool back){
+  uint16_t program = slideProgramID + (across ? 0 : 8) + (back ? 4 : 0) + line;
+
+  vdp_audio_play_sample(3,127);         // woosh
+
+  slideStart();
+  vduBufferCmd(program, 1);             // command 1 call
+  vduFlush();
+  for (uint8_t ff = 1; ff <= slideFrames ; ff++){
+    slideFrame();                       // the program reports each frame
   }
+}
 
-  FILE *filePointer = fopen(bitmapName, "r");                           // open the RGBA2222 image file
-  uint16_t count = 0;
+// -----------------------------------------------------------------------
+// record the 16 slides as VDP buffer programs, slideProgramID + 0-3 rows
+// right, 4-7 rows left, 8-11 columns down, 12-15 columns up
+// the line's tiles are put on the strip sprites, which cover it exactly,
+// then each frame moves the sprites a step on, waits for vsync and asks
+// where the cursor is so we can time it. Nothing is plotted until the end,
+// when the line is plotted where it finished, flipped into view and
+// plotted again in the other buffer, and the sprites are hidden. Then the
+// program moves the line's cell buffers on a cell, as scrollH() etc do
+// arrayBitmaps, so they are ready for the next slide without us sending
+// anything
+
+void makeSlidePrograms(void){
+  for (uint8_t variant = 0; variant < 16; variant++){
+    bool across = variant < 8;
+    bool back = (variant & 4) != 0;
+    uint8_t line = variant & 3;
+
+    recordStripStart(across, line, back);
+    for (uint8_t ff = 1; ff <= slideFrames ; ff++){
+      recordSlideFrame(across, line, back, ff);
+      vduByte(23); vduByte(0); vduByte(0xC3);         // VDU 23, 0, &C3: flip or wait for vsync
+      vduByte(23); vduByte(0); vduByte(0x82);         // VDU 23, 0, &82: request cursor position
+    }
 
-  // Load into 4 big rows first as separate buffers... then split each by width.
-  // big buffers will be ID 20-23
-  // smaller buffers will be 0-15
+    // the sprite that finished off the end is the current one while the
+    // line is plotted, so the frames the cell buffers pick go unseen
+    vduByte(23); vduByte(27); vduByte(4); vduByte(stripSpriteID + (back ? 0 : 3));
+    recordLinePlot(across, line, back);
+    vduByte(23); vduByte(0); vduByte(0xC3);           // now on screen under the sprites
+    for (uint8_t nn = 0; nn < stripSprites; nn++){
+      vduByte(23); vduByte(27); vduByte(4); vduByte(stripSpriteID + nn);
+      vduByte(23); vduByte(27); vduByte(12);          // hide it
+    }
+    vduByte(23); vduByte(27); vduByte(15);
+    recordLinePlot(across, line, back);               // and in the other buffer
+
+    uint16_t spare = cellBufferID + 16;
+    if (back) {
+      recordCopy(spare, cellID(across, line, 0));     // tile at 0 wraps round to 3
+      for (uint8_t nn = 0; nn < 3; nn++) recordCopy(cellID(across, line, nn), cellID(across, line, nn + 1));
+      recordCopy(cellID(across, line, 3), spare);
+    } else {
+      recordCopy(spare, cellID(across, line, 3));     // tile at 3 wraps round to 0
+      for (uint8_t nn = 3; nn > 0; nn--) recordCopy(cellID(across, line, nn), cellID(across, line, nn - 1));
+      recordCopy(cellID(across, line, 0), spare);
+    }
 
-  // read all data into 4 bitmap buffers, in 320 byte blocks, ie 60 blocks each
-  for (uint16_t rows = 0; rows < 4; rows++){
-          fread(buff, 1,19200 ,filePointer);                                 // read 80 byte chunk of data from file
-          vdp_adv_write_block_data((startBigBitmapID + rows), 19200, buff);       // send chunk into VDP buffer block 20 +
+    vduStore(slideProgramID + variant);
   }
+}
 
-  // we now have 4 big buffers 320x60 of data
-  // Command 20: Split by width into blocks and spread across blocks starting at target buffer ID
-
-  vdp_adv_split_by_width_multiple_from(startBigBitmapID + 0, chunkSizeW, chunksPerLine, startBitmapID + 0);
-  vdp_adv_split_by_width_multiple_from(startBigBitmapID + 1, chunkSizeW, chunksPerLine, startBitmapID + 4);
-  vdp_adv_split_by_width_multiple_from(startBigBitmapID + 2, chunkSizeW, chunksPerLine, startBitmapID + 8);
-  vdp_adv_split_by_width_multiple_from(startBigBitmapID + 3, chunkSizeW, chunksPerLine, startBitmapID + 12);
-
-  // turn all 16 buffers into bitmaps
-  for (uint16_t xx = 0; xx < 16 ; xx++){
-    vdp_adv_select_bitmap(startBitmapID + xx);
-    vdp_adv_bitmap_from_buffer(80 , 60, RGBA2222_format);    // make a bitmap to test
+// -----------------------------------------------------------------------
+// add the start of a slide to the program: strip sprite nn gets the tile of
+// the line's cell nn, 4 the one that wraps round, and is shown where it is
+// each tile is picked by calling the cell buffer that knows which it is
+// not in vdp.h yet
+// VDU 23, 0, &A0, bufferId; 1: Call a buffer
+// VDU 23, 27, 4, n: Select sprite n
+// VDU 23, 27, 13, x; y;: Move current sprite to pixel position x, y
+// VDU 23, 27, 11: Show current sprite
+
+void recordStripStart(bool across, uint8_t line, bool back){
+  for (uint8_t nn = 0; nn < stripSprites; nn++){
+    uint8_t from = (nn < 4) ? nn : (back ? 0 : 3);           // 4 is the wrap tile
+    uint16_t pos = slidePos(across, back, nn, 0);
+
+    vduByte(23); vduByte(27); vduByte(4); vduByte(stripSpriteID + nn);
+    vduBufferCmd(cellID(across, line, from), 1);             // call it, picks the frame
+    vduByte(23); vduByte(27); vduByte(13);
+    vduWord(across ? pos : line * chunkSizeW);
+    vduWord(across ? line * chunkSizeH : pos);
+    vduByte(23); vduByte(27); vduByte(11);
   }
+}
 
-  // clear original data as no longer needed
-  for (uint16_t bitmapNum = startBigBitmapID; bitmapNum < startBigBitmapID + 4 ; bitmapNum++){
-    vdp_adv_clear_buffer(bitmapNum);                         // clear the buffer
+// -----------------------------------------------------------------------
+// add a frame of a slide to the program: each strip sprite moved on, then
+// the sprites updated
+// VDU 23, 27, 4, n: Select sprite n
+// VDU 23, 27, 13, x; y;: Move current sprite to pixel position x, y
+// VDU 23, 27, 15: Update the sprites in the GPU
+
+void recordSlideFrame(bool across, uint8_t line, bool back, uint8_t frame){
+  for (uint8_t nn = 0; nn < stripSprites; nn++){
+    uint16_t pos = slidePos(across, back, nn, frame);
+
+    vduByte(23); vduByte(27); vduByte(4); vduByte(stripSpriteID + nn);
+    vduByte(23); vduByte(27); vduByte(13);
+    vduWord(across ? pos : line * chunkSizeW);
+    vduWord(across ? line * chunkSizeH : pos);
   }
-  fclose(filePointer);                                       // close the file
+  vduByte(23); vduByte(27); vduByte(15);
 }
 
 // -----------------------------------------------------------------------
+// add a plot of the line where it ends up to the program, each tile
+// selected by calling its cell buffer - the one off the end is left out
 
-void loadLabels(void){
-  // now load labels from labels.h and convert to sprites
+void recordLinePlot(bool across, uint8_t line, bool back){
+  for (uint8_t nn = 0; nn < stripSprites; nn++){
+    if (nn == (back ? 0 : 3)) continue;                      // off the end
+    uint8_t from = (nn < 4) ? nn : (back ? 0 : 3);
+    uint16_t pos = slidePos(across, back, nn, slideFrames);
 
-  makeLabel( label_sprite_start_ID + 0, label1, 32, 220);
-  makeLabel( label_sprite_start_ID + 1, label2, 112, 220);
-  makeLabel( label_sprite_start_ID + 2, label3, 192, 220);
-  makeLabel( label_sprite_start_ID + 3, label4, 273, 220);
+    vduBufferCmd(cellID(across, line, from), 1);             // call it, selects the tile
+    vduPlot(across ? pos : line * chunkSizeW, across ? line * chunkSizeH : pos);
+  }
+}
 
-  makeLabel( label_sprite_start_ID + 4, labelA, 4, 20);
-  makeLabel( label_sprite_start_ID + 5, labelB, 4, 85);
-  makeLabel( label_sprite_start_ID + 6, labelC, 4, 142);
-  makeLabel( label_sprite_start_ID + 7, labelD, 4, 202);
-  
-  // activate the sprites
+// -----------------------------------------------------------------------
+// where along the line tile nn of a slide is at frame, 4 is the wrap tile
+
+uint16_t slidePos(bool across, bool back, uint8_t nn, uint8_t frame){
+  uint16_t cell = across ? chunkSizeW : chunkSizeH;
+  uint16_t moved = (cell * frame) / slideFrames;
+  uint16_t pos = (nn < 4) ? nn * cell : (back ? 4 * cell : 0 - cell);
+
+  return back ? pos - moved : pos + moved;
+}
+
+// -----------------------------------------------------------------------
+// add a buffer copy to the program
+// not in vdp.h yet
+// VDU 23, 0, &A0, bufferId; 2: Clear a buffer
+// VDU 23, 0, &A0, targetBufferId; 13, sourceBufferId; 65535;: Copy buffers
+
+void recordCopy(uint16_t targetID, uint16_t sourceID){
+  vduBufferCmd(targetID, 2);
+  vduBufferCmd(targetID, 13);
+  vduWord(sourceID);
+  vduWord(65535);
+}
+
+// -----------------------------------------------------------------------
+// cell buffer of tile nn along a row (across) or column
+
+uint16_t cellID(bool across, uint8_t line, uint8_t nn){
+  return across ? cellBufferID + (line * hCells) + nn : cellBufferID + (nn * hCells) + line;
+}
+
+// -----------------------------------------------------------------------
+// write each cell buffer, commands to pick the tile in that cell as the
+// current sprite's frame and as the current bitmap, at the start of a
+// game - the slide programs keep them up to date
+// VDU 23, 27, 10, n: Select the nth frame of current sprite
+// VDU 23, 27, &20, bufferId;: Select bitmap using a buffer ID
+
+void writeCells(void){
+  for (uint8_t xx = 0; xx < hCells; xx++){
+    for (uint8_t yy = 0; yy < vCells; yy++){
+      uint16_t tile = arrayBitmaps[xx][yy] + tileBaseID;
+      char select[9] = {23, 27, 10, arrayBitmaps[xx][yy], 23, 27, 0x20, tile, tile >> 8};
+      vdp_adv_clear_buffer(cellBufferID + (yy * hCells) + xx);
+      vdp_adv_write_block_data(cellBufferID + (yy * hCells) + xx, 9, select);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------
+// VDU command builder - commands are put together in vduBuff and sent in
+// one mos_puts write, rather than a MOS call for every byte
+// vduFlush sends them, or vduStore makes them a buffer program instead
+// the longest thing built is a slide program, about 970 bytes
+
+void vduByte(uint8_t value){
+  vduBuff[vduLen++] = value;
+}
+
+void vduWord(uint16_t value){
+  vduByte(value);
+  vduByte(value >> 8);
+}
+
+void vduFlush(void){
+  if (vduLen == 0) return;
+  mos_puts(vduBuff, vduLen, 0);
+  vduBytes += vduLen;
+  vduWrites++;
+  vduLen = 0;
+}
+
+void vduStore(uint16_t bufferID){
+  vdp_adv_clear_buffer(bufferID);
+  vdp_adv_write_block_data(bufferID, vduLen, vduBuff);
+  vduLen = 0;
+}
+
+// VDU 23, 0, &A0, bufferId; command: the start of every buffer command
+
+void vduBufferCmd(uint16_t bufferID, uint8_t command){
+  vduByte(23); vduByte(0); vduByte(0xA0);
+  vduWord(bufferID);
+  vduByte(command);
+}
+
+// VDU 23, 27, &20, bufferId;: Select bitmap using a buffer ID
+// VDU 23, 27, 3, x; y;: Draw current bitmap on screen at pixel position x, y
+
+void vduSelect(uint16_t bufferID){
+  vduByte(23); vduByte(27); vduByte(0x20);
+  vduWord(bufferID);
+}
+
+void vduPlot(uint16_t x, uint16_t y){
+  vduByte(23); vduByte(27); vduByte(3);
+  vduWord(x);
+  vduWord(y);
+}
+
+// -----------------------------------------------------------------------
+// change screen mode and set it up the way we use it
+// the label sprites are made again in case the mode change lost them
+
+void setMode(uint8_t mode){
+  vdp_mode(mode);
+  vdp_cursor_enable(false);         // stop flashing cursor
+  vdp_clear_screen();
+  vdp_set_pixel_coordinates();      // set to pixel coord format
+  loadLabels();
+  currentMode = mode;
+}
+
+// -----------------------------------------------------------------------
+// tile cache - tile sets for several puzzles kept in VDP memory
+// slot n uses buffers startBitmapID + (n * 16), as many slots as fit in the budget
+
+void initTileCache(void){
+  numTileSlots = tileCacheBudget / ((uint32_t)numCells * chunkSizeW * chunkSizeH);   // bytes of one tile set
+  if (numTileSlots < 2) numTileSlots = 2;                   // one in play, one to load into
+  if (numTileSlots > maxTileSlots) numTileSlots = maxTileSlots;
+  tileBaseID = startBitmapID;                               // slot 0 until a puzzle is loaded
+
+  for (uint8_t slot = 0; slot < maxTileSlots; slot++){
+    slotPuzzle[slot] = noPuzzle;
+    slotReady[slot] = false;
+    slotLastUsed[slot] = 0;
+  }
+  for (uint8_t n = 0; n < iconStoreSize; n++){
+    storePuzzle[n] = noPuzzle;
+    storeReady[n] = false;
+    storeLastUsed[n] = 0;
+  }
+}
+
+// -----------------------------------------------------------------------
+// make the tiles of puzzle pc the current ones
+// if they are already in a tile slot (played before, or prefetched by the
+// picker) we just switch to that slot, otherwise load them into the least
+// recently used slot
+
+void loadBitmaps(uint16_t pc)
+{
+  clock_t startTime = clock();
+  loadBytes = 0;
+  readTicks = 0;
+
+  if (prefetchActive && prefetch.puzzle == pc) {
+    while (!loaderStep(&prefetch));                         // nearly there, so finish it
+    slotLoaded(prefetchSlot);
+    prefetchActive = false;
+  }
+  if (prefetchActive) {
+    loaderCancel(&prefetch);                                // wrong one, so stop it
+    slotPuzzle[prefetchSlot] = noPuzzle;
+    prefetchActive = false;
+  }
+
+  int8_t slot = findSlot(pc);
+  if (slot >= 0 && slotReady[slot] && !tagResident(slotTagID + slot, slotStamp[slot])) {
+    slotReady[slot] = false;                                // VDP was reset, its buffers are gone
+  }
+  if (slot >= 0 && slotReady[slot]) {
+    currentSlot = slot;                                     // already there, just swap over
+    cacheHits++;
+  } else {
+    cacheMisses++;
+    if (slot < 0) slot = lruSlot(NULL, 0);
+    currentSlot = slot;
+    slotPuzzle[currentSlot] = pc;
+    slotReady[currentSlot] = false;
+    if (loaderStart(&mainLoader, pc, startBitmapID + (currentSlot * numCells))) {
+      vdp_clear_screen();
+      showPreview(pc);                                      // something to look at straight away
+      mainLoader.reveal = true;                             // show the picture as it arrives
+      while (!loaderStep(&mainLoader));
+      mainLoader.reveal = false;
+      slotLoaded(currentSlot);
+      loadBytes = mainLoader.bytes;
+      readTicks = mainLoader.readTicks;
+    } else {
+      slotPuzzle[currentSlot] = noPuzzle;
+    }
+  }
+
+  slotLastUsed[currentSlot] = ++useCount;
+  tileBaseID = startBitmapID + (currentSlot * numCells);
+  loadTicks = clock() - startTime;
+}
+
+// -----------------------------------------------------------------------
+// plot the picker icon of puzzle pc scaled x4 to fill the screen, as a
+// stand in until the real tiles are plotted over it
+// nothing to show if the picker has not been used yet
+
+void showPreview(uint16_t pc){
+  uint8_t place = pc % iconsPerPage;
+  if (iconPage != pc / iconsPerPage || !iconReady[place]) return;
+
+  if (!previewTransformMade) {
+    // Commands 32 and 33: Create or manipulate a 2D or 3D affine transformation matrix
+    // VDU 23, 0, &A0, bufferId; 32, operation, [<format>, <arguments...>]
+    vdp_adv_clear_buffer(transformID);
+    vduBufferCmd(transformID, 32);      // command no 32
+    vduByte(5);       // operation 5=scale
+    vduByte(0x00 | 0x40 | 0x80);    // format fixed point, 16 bit, shift point x 0.
+    vduWord(4);     // arguments x scale
+    vduWord(4);     // arguments y scale
+    previewTransformMade = true;
+  }
+
+  // Command 40: Create a transformed bitmap
+  // VDU 23, 0, &A0, bufferId; 40, options, transformBufferId; sourceBitmapId; [width; height;]
+  vdp_adv_clear_buffer(previewBitmapID);
+  vduBufferCmd(previewBitmapID, 40);   // command
+  vduByte(1);       // options; resize 1
+  vduWord(transformID);
+  vduWord(startIconBitmapID + place);
+  vduFlush();
+
+  vdp_adv_select_bitmap(previewBitmapID);
+  vdp_plot_bitmap(0, 0);
+  vdp_adv_clear_buffer(previewBitmapID);    // it is on screen now, so free the 76,800 bytes
+}
+
+// -----------------------------------------------------------------------
+// tile slot slot has finished loading, so stamp its tag buffer
+// loadBitmaps() checks the stamp is still there before using the slot
+
+void slotLoaded(uint8_t slot){
+  slotStamp[slot] = ((uint32_t)++slotLoads << 16) | slotPuzzle[slot];
+  char tag[4] = {slotStamp[slot], slotStamp[slot] >> 8, slotStamp[slot] >> 16, slotStamp[slot] >> 24};
+  vdp_adv_clear_buffer(slotTagID + slot);
+  vdp_adv_write_block_data(slotTagID + slot, 4, tag);
+  slotReady[slot] = true;
+}
+
+// -----------------------------------------------------------------------
+// which tile slot has puzzle pc in it, -1 if none
+
+int8_t findSlot(uint16_t pc){
+  for (uint8_t slot = 0; slot < numTileSlots; slot++){
+    if (slotPuzzle[slot] == pc) return slot;
+  }
+  return -1;
+}
+
+// -----------------------------------------------------------------------
+// least recently used slot, but never the one in play while the picker is
+// prefetching (keep != NULL), or one holding any of the keep puzzles
+
+uint8_t lruSlot(uint16_t keep[], uint8_t keepCount){
+  uint8_t best = 0;
+  uint16_t bestUsed = 0xFFFF;
+
+  for (uint8_t slot = 0; slot < numTileSlots; slot++){
+    if (keep != NULL && slot == currentSlot) continue;
+    bool kept = false;
+    for (uint8_t kk = 0; kk < keepCount; kk++){
+      if (slotPuzzle[slot] != noPuzzle && slotPuzzle[slot] == keep[kk]) kept = true;
+    }
+    if (kept) continue;
+    if (slotLastUsed[slot] < bestUsed) {
+      best = slot;
+      bestUsed = slotLastUsed[slot];
+    }
+  }
+  return (bestUsed == 0xFFFF) ? noSlot : best;
+}
+
+// -----------------------------------------------------------------------
+// prefetch - called by the picker while no key is down
+// does one small step of loading the highlighted picture, then the next,
+// then the previous one, into the spare tile slots
+
+void prefetchStep(uint16_t sel){
+  uint16_t wanted[3];
+  wanted[0] = sel;
+  wanted[1] = (sel + 1) % numPuzzles;
+  wanted[2] = (sel + numPuzzles - 1) % numPuzzles;
+
+  if (prefetchActive) {
+    if (prefetch.puzzle != wanted[0] && prefetch.puzzle != wanted[1] && prefetch.puzzle != wanted[2]) {
+      loaderCancel(&prefetch);                              // moved away, no longer needed
+      slotPuzzle[prefetchSlot] = noPuzzle;
+      prefetchActive = false;
+    } else {
+      if (loaderStep(&prefetch)) {
+        slotLoaded(prefetchSlot);
+        prefetchActive = false;
+      }
+      return;
+    }
+  }
+
+  for (uint8_t ww = 0; ww < 3; ww++){
+    if (findSlot(wanted[ww]) >= 0) continue;                // got it already
+
+    // use the oldest slot that isn't in play and isn't holding one we want
+    uint8_t slot = lruSlot(wanted, 3);
+    if (slot == noSlot) return;                             // no room
+
+    slotPuzzle[slot] = wanted[ww];
+    slotReady[slot] = false;
+    slotLastUsed[slot] = ++useCount;
+    if (loaderStart(&prefetch, wanted[ww], startBitmapID + (slot * numCells))) {
+      prefetchSlot = slot;
+      prefetchActive = true;
+    } else {
+      slotPuzzle[slot] = noPuzzle;
+    }
+    return;
+  }
+}
+
+// -----------------------------------------------------------------------
+// open picture pc and read its header
+// palette goes into the loader, so each loader keeps its own
+// leaves the file just after the header
+// whole - the caller will read all of it, so a copy is kept in ramCache
+
+bool loaderOpen(TileLoader *ld, uint16_t pc, bool whole){
+  ld->puzzle = pc;
+  ld->fileStart = (packPointer != NULL) ? myPackOffset[pc] : 0;
+  ld->filePos = ld->fileStart;
+  ld->direct = false;
+  ld->toRam = false;
+
+  uint8_t n = ramCacheOn ? ramFind(pc) : noSlot;
+  ld->fromRam = (n != noSlot && ramEntries[n].complete);
+  if (ld->fromRam) {
+    ramEntries[n].users++;                                  // read it from RAM
+    ramEntries[n].lastUsed = ++ramUseCount;
+    ramHits++;
+  } else {
+    if (packPointer != NULL) {
+      ld->ffs = &packFile;                                  // already open, just seek in it
+      ld->direct = directReads && packDirect;
+    } else {
+      char thisFile[48];
+      strcpy(thisFile, directoryName);
+      strcat(thisFile, puzzleName(pc));
+      if (windowOwner == &ld->own) windowOwner = NULL;      // window holds the last file read
+      ld->ffs = &ld->own;
+      ld->direct = directReads && ffs_fopen(&ld->own.fil, thisFile, FA_READ) == 0;
+      ld->own.pos = 0;
+    }
+    if (!ld->direct) {
+      ld->filePointer = openPuzzle(pc);                     // stdio instead
+      if (ld->filePointer == NULL) return false;
+    }
+    if (ramCacheOn && whole) {                              // an icon alone is not worth a place
+      ramMisses++;
+      if (n == noSlot) ld->toRam = (ramAdd(pc, myFileSize[pc]) != noSlot);   // keep a copy
+    }
+  }
+
+  ld->format = puzzleFormat(puzzleName(pc));
+  ld->bpp = 8;
+  ld->readTicks = 0;
+
+  if (ld->format == formatRGB2) return true;                // raw data, no header
+
+  // .RGB2Z - "RGBZ", then icon and 16 separately compressed tiles (see tools/rgb2z.py)
+  // .RGB2P - "RGBP", bits per pixel, palette size, then palette (see tools/rgb2p.py)
+  char header[8];
+  loaderRead(ld, header, 8);
+  if (ld->format == formatRGB2Z && memcmp(header, "RGBZ", 4) == 0) return true;
+
+  if (ld->format == formatRGB2P && memcmp(header, "RGBP", 4) == 0) {
+    uint8_t bpp = header[5];
+    uint8_t entries = header[6];
+    if ((bpp == 4 || bpp == 6) && entries <= (1 << bpp)) {
+      ld->bpp = bpp;
+      memset(ld->lut, 0, sizeof(ld->lut));
+      loaderRead(ld, ld->lut, entries);
+      return true;
+    }
+  }
+
+  loaderClose(ld);                                          // not a picture we understand
+  return false;
+}
+
+// -----------------------------------------------------------------------
+// read the next len bytes of a loader's picture
+// the direct path reads a sector or more with ffs_fread straight into dest,
+// smaller reads come from sectorWindow, which reads ahead. Loaders share
+// the one open slider.pak, so it is only seeked when a read is not where
+// the last one on it ended. The stdio path just uses fread
+
+void loaderRead(TileLoader *ld, void *dest, uint16_t len){
+  clock_t startTime = clock();
+  char *to = dest;
+  uint32_t from = ld->filePos - ld->fileStart;              // within the picture
+
+  if (ld->fromRam || ld->toRam) {
+    uint8_t n = ramFind(ld->puzzle);                        // entries move when others are dropped
+    uint16_t inFile = (from >= ramEntries[n].size) ? 0
+                    : (ramEntries[n].size - from < len) ? ramEntries[n].size - from : len;
+    if (ld->fromRam) {
+      memcpy(to, ramData(n) + from, inFile);
+      memset(to + inFile, 0, len - inFile);
+      ld->filePos += len;
+      ld->readTicks += clock() - startTime;
+      return;
+    }
+  }
+
+  if (!ld->direct) {
+    fread(to, 1, len, ld->filePointer);
+    ld->filePos += len;
+  }
+
+  uint16_t left = ld->direct ? len : 0;
+  while (left > 0) {
+    if (windowOwner == ld->ffs && ld->filePos >= windowStart && ld->filePos < windowStart + windowLen) {
+      uint16_t at = ld->filePos - windowStart;              // already read ahead
+      uint16_t n = windowLen - at;
+      if (n > left) n = left;
+      memcpy(to, sectorWindow + at, n);
+      to += n;
+      ld->filePos += n;
+      left -= n;
+      continue;
+    }
+
+    size_t got = 0;
+    if (ld->ffs->pos != ld->filePos) ffs_flseek(&ld->ffs->fil, ld->filePos);
+    if (left >= sectorSize) {                               // big enough, straight into dest
+      ffs_fread(&ld->ffs->fil, to, left, &got);
+      ld->ffs->pos = ld->filePos + got;
+      memset(to + got, 0, left - got);                      // past the end of the file
+      ld->filePos += left;
+      break;
+    }
+    ffs_fread(&ld->ffs->fil, sectorWindow, SECTOR_WINDOW, &got);
+    ld->ffs->pos = ld->filePos + got;
+    windowStart = ld->filePos;
+    windowLen = got;
+    windowOwner = ld->ffs;
+    if (got == 0) {                                         // past the end of the file
+      memset(to, 0, left);
+      ld->filePos += left;
+      break;
+    }
+  }
+
+  if (ld->toRam) {
+    uint8_t n = ramFind(ld->puzzle);
+    if (from < ramEntries[n].size) {
+      uint32_t keep = ramEntries[n].size - from;
+      memcpy(ramData(n) + from, dest, (keep < len) ? keep : len);
+    }
+  }
+  ld->readTicks += clock() - startTime;
+}
+
+// -----------------------------------------------------------------------
+// finished with a loader's file
+
+void loaderClose(TileLoader *ld){
+  if (ld->fromRam || ld->toRam) {
+    uint8_t n = ramFind(ld->puzzle);
+    ramEntries[n].users--;
+    if (ld->toRam) {
+      if (ld->filePos - ld->fileStart >= ramEntries[n].size) ramEntries[n].complete = true;
+      else ramDrop(n);                                      // only part read, so no use
+    }
+  }
+  if (ld->fromRam) {
+    ld->fromRam = false;
+    return;                                                 // no file was opened
+  }
+  ld->toRam = false;
+
+  if (ld->direct && ld->ffs == &ld->own) {
+    ffs_fclose(&ld->own.fil);                               // the pack stays open
+    if (windowOwner == &ld->own) windowOwner = NULL;
+  }
+  if (!ld->direct) closePuzzle(ld->filePointer);
+}
+
+// -----------------------------------------------------------------------
+// RAM cache - whole picture files kept in eZ80 memory as they are read, so
+// loading one again (a swap back after its tile slot was reused, or after
+// the VDP has lost its buffers) only has to send it to the VDP
+// entries are packed one after another from the start of ramCache
+
+// -----------------------------------------------------------------------
+// get as much of RAM_CACHE_SIZE as the heap can spare, a raw picture less
+// at a time, none at all leaves the cache off
+
+void initRamCache(void){
+  uint32_t picture = (uint32_t)bitmapWidth * bitmapHeight;
+  for (uint32_t size = RAM_CACHE_SIZE; size >= picture; size -= picture){
+    ramCache = malloc(size);
+    if (ramCache == NULL) continue;
+    char *spare = malloc(RAM_HEADROOM);                     // still room for everything else?
+    if (spare != NULL) {
+      free(spare);
+      ramCacheBudget = size;
+      return;
+    }
+    free(ramCache);
+  }
+  ramCache = NULL;
+  ramCacheOn = false;
+}
+
+// -----------------------------------------------------------------------
+
+uint8_t ramFind(uint16_t pc){
+  for (uint8_t n = 0; n < numRamEntries; n++){
+    if (ramEntries[n].puzzle == pc) return n;
+  }
+  return noSlot;
+}
+
+char *ramData(uint8_t n){
+  char *at = ramCache;
+  for (uint8_t k = 0; k < n; k++) at += ramEntries[k].size;
+  return at;
+}
+
+// -----------------------------------------------------------------------
+// make room for size bytes of picture pc at the end of ramCache, dropping
+// the least recently used pictures that nobody is reading
+// returns its entry, or noSlot if it won't fit
+
+uint8_t ramAdd(uint16_t pc, uint32_t size){
+  if (size > ramCacheBudget) return noSlot;
+
+  while (ramUsed + size > ramCacheBudget || numRamEntries == maxRamEntries){
+    uint8_t oldest = noSlot;
+    for (uint8_t n = 0; n < numRamEntries; n++){
+      if (ramEntries[n].users > 0) continue;
+      if (oldest == noSlot || ramEntries[n].lastUsed < ramEntries[oldest].lastUsed) oldest = n;
+    }
+    if (oldest == noSlot) return noSlot;                    // all in use
+    ramDrop(oldest);
+  }
+
+  RamEntry *entry = &ramEntries[numRamEntries];
+  entry->puzzle = pc;
+  entry->size = size;
+  entry->lastUsed = ++ramUseCount;
+  entry->users = 1;
+  entry->complete = false;
+  ramUsed += size;
+  return numRamEntries++;
+}
+
+// -----------------------------------------------------------------------
+// remove entry n, moving the pictures after it down to close the gap
+
+void ramDrop(uint8_t n){
+  char *at = ramData(n);
+  uint32_t size = ramEntries[n].size;
+  memmove(at, at + size, ramUsed - (at - ramCache) - size);
+  ramUsed -= size;
+  numRamEntries--;
+  for (uint8_t k = n; k < numRamEntries; k++) ramEntries[k] = ramEntries[k + 1];
+}
+
+// -----------------------------------------------------------------------
+// get ready to load picture pc into the 16 tile buffers from baseID
+
+bool loaderStart(TileLoader *ld, uint16_t pc, uint16_t baseID){
+  if (!loaderOpen(ld, pc, true)) return false;
+
+  ld->icon = iconStoreAdd(pc);                              // make its icon as we go
+  if (ld->format == formatRGB2Z) {
+    if (ld->icon != noSlot) loaderRead(ld, storeIcon[ld->icon], iconSize);   // stored ready made
+    else if (ld->toRam) {                                   // read it anyway, or the RAM copy has a hole
+      for (uint16_t done = 0; done < iconSize; done += sizeof(buff)) {
+        loaderRead(ld, buff, (iconSize - done < sizeof(buff)) ? iconSize - done : sizeof(buff));
+      }
+    }
+    else ld->filePos += iconSize;                           // skip it
+  }
+
+  ld->baseID = baseID;
+  ld->step = 0;
+  ld->bytes = 0;
+
+  for (uint16_t xx = 0; xx < numCells ; xx++){
+    vdp_adv_clear_buffer(baseID + xx);                      // clear all buffers
+  }
+  vdp_adv_clear_buffer(ld->tempID);
+  return true;
+}
+
+// -----------------------------------------------------------------------
+// do the next 1/16th of the load, returns true when all 16 bitmaps are made
+// each band's (or compressed tile's) bitmaps are made as soon as it is done
+// raw and palette pictures go a quarter band (15 lines) at a time, each
+// tile's part written straight into its tile buffer, so nothing but the
+// tiles themselves is held in VDP memory
+// compressed pictures go one tile at a time, expanded by the VDP
+
+bool loaderStep(TileLoader *ld){
+  if (!ld->direct && !ld->fromRam) fseek(ld->filePointer, ld->filePos, SEEK_SET);   // the pack may have been used since
+
+  if (ld->format == formatRGB2Z) {
+    uint8_t lenBytes[2];
+    loaderRead(ld, lenBytes, 2);                            // compressed tile length, LSB first
+    uint16_t len = lenBytes[0] | (lenBytes[1] << 8);
+    vdp_adv_clear_buffer(ld->tempID);
+    while (len > 0){
+      uint16_t chunk = (len > sizeof(buff)) ? sizeof(buff) : len;
+      loaderRead(ld, buff, chunk);
+      vdp_adv_write_block_data(ld->tempID, chunk, buff);    // send compressed tile a piece at a time
+      ld->bytes += chunk;
+      len -= chunk;
+    }
+    vdp_adv_consolidate(ld->tempID);
+    decompressBuffer(ld->baseID + ld->step, ld->tempID);   // and expand it into the tile buffer
+    vdp_adv_clear_buffer(ld->tempID);
+    tileReady(ld, ld->step);
+  } else {
+    uint16_t firstTile = ld->baseID + ((ld->step / 4) * chunksPerLine);
+    char *span = buff + (stageLines * bitmapWidth);         // second half of buff
+    uint16_t linesLeft = chunkSizeH / 4;                    // 15 lines a step
+
+    while (linesLeft > 0){
+      uint16_t lines = (linesLeft > stageLines) ? stageLines : linesLeft;
+      readLines(ld, lines);                                 // read a few lines of data from file
+      if (ld->icon != noSlot) shrinkLines(storeIcon[ld->icon], (ld->step * (chunkSizeH / 4)) + (chunkSizeH / 4) - linesLeft, lines);
+
+      // gather each tile's 80 byte part of every line, and send it straight to that tile
+      for (uint16_t col = 0; col < chunksPerLine; col++){
+        for (uint16_t yy = 0; yy < lines; yy++){
+          memcpy(span + (yy * chunkSizeW), buff + (yy * bitmapWidth) + (col * chunkSizeW), chunkSizeW);
+        }
+        vdp_adv_write_block_data(firstTile + col, lines * chunkSizeW, span);
+      }
+      ld->bytes += lines * bitmapWidth;
+      linesLeft -= lines;
+    }
+
+    if ((ld->step % 4) == 3) {
+      for (uint16_t col = 0; col < chunksPerLine; col++){
+        vdp_adv_consolidate(firstTile + col);               // tile complete
+        tileReady(ld, firstTile + col - ld->baseID);
+      }
+    }
+  }
+
+  ld->step++;
+  if (ld->step < numCells) return false;
+
+  if (ld->icon != noSlot) storeReady[ld->icon] = true;
+  loaderClose(ld);                                          // close the file
+  return true;
+}
+
+// -----------------------------------------------------------------------
+// tile buffer complete, so turn it into a bitmap
+// and if revealing, show it straight away rather than waiting for the rest
+
+void tileReady(TileLoader *ld, uint8_t tile){
+  vdp_adv_select_bitmap(ld->baseID + tile);
+  vdp_adv_bitmap_from_buffer(chunkSizeW, chunkSizeH, RGBA2222_format);
+  if (ld->reveal) vdp_plot_bitmap((tile % hCells) * chunkSizeW, (tile / hCells) * chunkSizeH);
+}
+
+// -----------------------------------------------------------------------
+// give up part way through a load
+
+void loaderCancel(TileLoader *ld){
+  loaderClose(ld);
+  if (ld->icon != noSlot) storePuzzle[ld->icon] = noPuzzle;   // half made
+  vdp_adv_clear_buffer(ld->tempID);
+}
+
+// -----------------------------------------------------------------------
+// not in vdp.h yet
+// Command 65: Decompress a buffer
+// VDU 23, 0, &A0, targetBufferId; 65, sourceBufferId;
+
+void decompressBuffer(uint16_t targetID, uint16_t sourceID){
+  vduBufferCmd(targetID, 65);     // command
+  vduWord(sourceID);
+  vduFlush();
+}
+
+// -----------------------------------------------------------------------
+// work out image format from file name
+
+uint8_t puzzleFormat(char name[]){
+  char *dot = strrchr(name, '.');
+  if (dot == NULL) return formatRGB2;
+
+  char ext[8];
+  uint8_t n = 0;
+  while (dot[n] != 0 && n < 7) {
+    ext[n] = toupper(dot[n]);
+    n++;
+  }
+  ext[n] = 0;
+
+  if (strcmp(ext, ".RGB2Z") == 0) return formatRGB2Z;
+  if (strcmp(ext, ".RGB2P") == 0) return formatRGB2P;
+  if (strcmp(ext, ".PAK") == 0) return formatNone;
+  return formatRGB2;                                        // anything else is raw RGBA2222
+}
+
+// -----------------------------------------------------------------------
+// read the next lines of the picture into buff as RGBA2222
+// bpp 8 is a raw file, 4 and 6 are palette files expanded through the lut
+// packed data is read into the end of the space and expanded forwards over itself
+
+void readLines(TileLoader *ld, uint16_t lines){
+  uint16_t len = lines * bitmapWidth;
+
+  if (ld->bpp == 8) {
+    loaderRead(ld, buff, len);
+  } else {
+    uint16_t packedLen = (len / 8) * ld->bpp;
+    uint8_t *in = (uint8_t *) buff + len - packedLen;
+    uint8_t *out = (uint8_t *) buff;
+    loaderRead(ld, in, packedLen);
+
+    if (ld->bpp == 4) {
+      for (uint16_t n = 0; n < packedLen; n++){
+        uint8_t v = *in++;
+        *out++ = ld->lut[v >> 4];                           // 2 pixels per byte
+        *out++ = ld->lut[v & 0x0F];
+      }
+    } else {
+      for (uint16_t n = 0; n < packedLen; n += 3){
+        uint32_t bits = ((uint32_t)in[0] << 16) | ((uint32_t)in[1] << 8) | in[2];
+        in += 3;
+        *out++ = ld->lut[(bits >> 18) & 0x3F];              // 4 pixels per 3 bytes
+        *out++ = ld->lut[(bits >> 12) & 0x3F];
+        *out++ = ld->lut[(bits >> 6) & 0x3F];
+        *out++ = ld->lut[bits & 0x3F];
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------
+
+void loadLabels(void){
+  // label bitmaps were loaded from slider.dat by loadAssets(), make them sprites
+
+  makeLabel( label_sprite_start_ID + 0, 32, 220);
+  makeLabel( label_sprite_start_ID + 1, 112, 220);
+  makeLabel( label_sprite_start_ID + 2, 192, 220);
+  makeLabel( label_sprite_start_ID + 3, 273, 220);
+
+  makeLabel( label_sprite_start_ID + 4, 4, 20);
+  makeLabel( label_sprite_start_ID + 5, 4, 85);
+  makeLabel( label_sprite_start_ID + 6, 4, 142);
+  makeLabel( label_sprite_start_ID + 7, 4, 202);
+  
+  // activate the sprites
   vdp_activate_sprites(numSprites);
   vdp_refresh_sprites();
 }
 
 // -----------------------------------------------------------------------
 
-void makeLabel(uint16_t id, char name[] ,uint16_t xxx, uint16_t yyy ){
-  vdp_select_bitmap(id);
-  vdp_load_bitmap( 16, 16, (uint8_t *) name );
+void makeLabel(uint16_t id, uint16_t xxx, uint16_t yyy ){
   vdp_select_sprite(id);
   vdp_clear_sprite();
   vdp_add_sprite_bitmap(id);
@@ -1000,19 +2418,345 @@ void makeLabel(uint16_t id, char name[] ,uint16_t xxx, uint16_t yyy ){
   vdp_move_sprite_to( xxx, yyy );
 }
 
+// -----------------------------------------------------------------------
+// the strip sprites, which carry a row or column while it slides, each with
+// the 16 tiles of the puzzle in play as its frames - the slide programs
+// pick which. Hidden until a slide shows them
+// not in vdp.h yet
+// VDU 23, 27, &26, bufferId;: Add bitmap to current sprite using a buffer ID
+
+void makeStripSprites(void){
+  for (uint8_t nn = 0; nn < stripSprites; nn++){
+    vdp_select_sprite(stripSpriteID + nn);
+    vdp_clear_sprite();
+    for (uint8_t tile = 0; tile < numCells; tile++){
+      vduByte(23); vduByte(27); vduByte(0x26);
+      vduWord(tileBaseID + tile);
+    }
+    vduFlush();
+    vdp_set_hardware_sprite();
+    vdp_hide_sprite();
+  }
+  vdp_activate_sprites(numSprites + stripSprites);
+  vdp_refresh_sprites();
+}
+
+// -----------------------------------------------------------------------
+// sounds and label bitmaps, from slider.dat
+// each one's hash is kept in a tag buffer on the VDP, so when slider is run
+// again (after ESC) anything still there with the same hash is not sent again
+// lazy ones are left until needAsset() asks for them
+
+void loadAssets(void){
+  clock_t startTime = clock();
+  FILE *filePointer = fopen(assetName, "rb");
+  if (filePointer == NULL) {
+    printf("%s not found\r\n", assetName);
+    return;
+  }
+
+  char header[8];
+  if (fread(header, 1, 8, filePointer) == 8 && memcmp(header, assetMagic, 4) == 0 && header[4] == assetVersion) {
+    numAssets = header[5];
+    if (numAssets > maxAssets) numAssets = maxAssets;
+    if (fread(assets, sizeof(AssetEntry), numAssets, filePointer) != numAssets) numAssets = 0;
+  }
+
+  for (uint8_t n = 0; n < numAssets; n++) {
+    assetLoaded[n] = false;
+    if (!(assets[n].flags & assetLazy)) loadAsset(filePointer, n);
+  }
+  fclose(filePointer);
+  assetTicks = clock() - startTime;
+}
+
+// -----------------------------------------------------------------------
+// make sure the asset of this kind and id is on the VDP, however it is stored
+// returns true if it had to be loaded now
+
+bool needAsset(uint8_t kind, uint8_t id){
+  for (uint8_t n = 0; n < numAssets; n++) {
+    uint8_t thisKind = assets[n].kind == assetSampleADPCM ? assetSample : assets[n].kind;
+    if (thisKind != kind || assets[n].id != id) continue;
+    if (assetLoaded[n]) return false;
+
+    FILE *filePointer = fopen(assetName, "rb");
+    if (filePointer == NULL) return false;
+    loadAsset(filePointer, n);
+    fclose(filePointer);
+    return true;
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------
+// upload asset n, unless the VDP still has it, and make its sample or bitmaps
+
+void loadAsset(FILE *filePointer, uint8_t n){
+  AssetEntry *entry = &assets[n];
+  bool sample = entry->kind == assetSample || entry->kind == assetSampleADPCM;
+  uint16_t bufferID;
+  if (sample) bufferID = 64257 - entry->id;       // sample -1 is buffer 64256
+  else bufferID = 64000 + entry->id;              // bitmap n is buffer 64000+n
+
+  if (!tagResident(assetTagID + n, entry->hash)) {
+    uint16_t uploadID = entry->kind == assetAtlas ? atlasID : bufferID;
+    vdp_adv_clear_buffer(assetTagID + n);   // no longer valid until the upload is done
+    vdp_adv_clear_buffer(uploadID);
+    fseek(filePointer, entry->offset, SEEK_SET);
+    if (entry->kind == assetSampleADPCM) {
+      sendADPCM(filePointer, entry->size, uploadID);
+    } else {
+      uint32_t left = entry->size;
+      while (left > 0) {
+        uint16_t chunk = left > sizeof(buff) ? sizeof(buff) : left;
+        fread(buff, 1, chunk, filePointer);
+        vdp_adv_write_block_data(uploadID, chunk, buff);
+        left -= chunk;
+      }
+      assetBytes += entry->size;
+    }
+    vdp_adv_consolidate(uploadID);
+
+    if (entry->kind == assetAtlas) {
+      // one upload for all of them, expanded and cut up on the VDP
+      vdp_adv_clear_buffer(atlasID + 1);
+      decompressBuffer(atlasID + 1, atlasID);
+      splitBuffer(atlasID + 1, entry->width * entry->height, bufferID);
+      vdp_adv_clear_buffer(atlasID);
+      vdp_adv_clear_buffer(atlasID + 1);
+    }
+
+    char tag[4] = {entry->hash, entry->hash >> 8, entry->hash >> 16, entry->hash >> 24};
+    vdp_adv_write_block_data(assetTagID + n, 4, tag);
+  }
+
+  // the sample or bitmap itself is remade either way, it costs a few bytes
+  if (sample) {
+    makeSample(bufferID);
+  } else if (entry->kind == assetBitmap) {
+    vdp_adv_select_bitmap(bufferID);
+    vdp_adv_bitmap_from_buffer(entry->width, entry->height, 0);   // RGBA8888
+  } else {
+    for (uint8_t b = 0; b < entry->count; b++) {
+      vdp_adv_select_bitmap(bufferID + b);
+      vdp_adv_bitmap_from_buffer(entry->width, entry->height, RGBA2222_format);
+    }
+  }
+  assetLoaded[n] = true;
+}
+
+// -----------------------------------------------------------------------
+// expand a 4 bit IMA ADPCM sample to 8 bit signed as it is read, and send it
+// a 4 byte sample count, then 2 samples a byte, low nibble first
+// each read goes in the last third of buff and is expanded forwards from the start
+
+void sendADPCM(FILE *filePointer, uint32_t size, uint16_t bufferID){
+  uint32_t samples;
+  int32_t predictor = 0;
+  int8_t index = 0;
+  fread(&samples, 1, 4, filePointer);
+  size -= 4;
+
+  while (size > 0) {
+    uint16_t chunk = size > sizeof(buff) / 3 ? sizeof(buff) / 3 : size;
+    char *in = buff + sizeof(buff) - chunk;
+    fread(in, 1, chunk, filePointer);
+    size -= chunk;
+
+    uint16_t out = 0;
+    for (uint16_t i = 0; i < chunk * 2 && samples > 0; i++, samples--) {
+      uint8_t code = (i & 1) ? (uint8_t)in[i >> 1] >> 4 : in[i >> 1] & 15;
+      int16_t step = adpcmSteps[index];
+      int32_t diff = step >> 3;
+      if (code & 4) diff += step;
+      if (code & 2) diff += step >> 1;
+      if (code & 1) diff += step >> 2;
+      predictor += (code & 8) ? -diff : diff;
+      if (predictor > 32767) predictor = 32767;
+      if (predictor < -32768) predictor = -32768;
+      index += adpcmIndex[code & 7];
+      if (index < 0) index = 0;
+      if (index > 88) index = 88;
+      buff[out++] = predictor >> 8;
+    }
+    vdp_adv_write_block_data(bufferID, out, buff);
+    assetBytes += out;
+  }
+}
+
+// -----------------------------------------------------------------------
+// cut a buffer into blocks of blockSize bytes, in buffers targetID onwards
+// not in vdp.h yet
+// VDU 23, 0, &A0, bufferId; 17, blockSize; targetBufferId;
+
+void splitBuffer(uint16_t bufferID, uint16_t blockSize, uint16_t targetID){
+  vduBufferCmd(bufferID, 17);     // command 17 split into blocks, spread from target
+  vduWord(blockSize);
+  vduWord(targetID);
+  vduFlush();
+}
+
+// -----------------------------------------------------------------------
+// does the VDP still have tag buffer tagID holding this hash? An asset's tag
+// may be from the last run, a tile slot's is gone if the VDP has been reset
+// not in vdp.h yet
+// VDU 23, 0, &A0, bufferId; 6, operation, checkBufferId; checkOffset; [arguments]
+// Command 6: Conditional call - call bufferId if the check passes, here byte
+// k of the tag equal to byte k of the hash. Each of the 4 checks calls the
+// next, the last one the hit buffer. Then we ask where the cursor is.
+
+bool tagResident(uint16_t tagID, uint32_t hash){
+  uint8_t h[4] = {hash, hash >> 8, hash >> 16, hash >> 24};
+
+  // a match calls this, which moves the text cursor to column 1
+  // sent every time, as a VDP reset takes it too
+  vdp_adv_clear_buffer(assetProbeID + 3);
+  char hit[3] = {31, 1, 0};                 // VDU 31, x, y
+  vdp_adv_write_block_data(assetProbeID + 3, 3, hit);
+
+  for (uint8_t k = 1; k < 4; k++) {         // checks of bytes 1-3 are in buffers 320-322
+    uint16_t next = assetProbeID + k;       // the one after, or the hit buffer
+    char probe[12] = {23, 0, 0xA0, next, next >> 8, 6, 2, tagID, tagID >> 8, k, 0, h[k]};
+    vdp_adv_clear_buffer(assetProbeID + k - 1);
+    vdp_adv_write_block_data(assetProbeID + k - 1, 12, probe);
+  }
+
+  vduByte(31); vduByte(0); vduByte(0);      // VDU 31, x, y - cursor to 0,0
+
+  vduBufferCmd(assetProbeID, 6);            // call the next check, command 6 conditional call
+  vduByte(2);                               // operation 2 = equal
+  vduWord(tagID);                           // check buffer
+  vduWord(0);                               // offset
+  vduByte(h[0]);
+
+  return waitVDP() && sv->cursorX == 1;
+}
+
+// -----------------------------------------------------------------------
+// wait until the VDP has done everything sent so far, by asking where the
+// text cursor is - it answers once it gets to the request
+// anything still in vduBuff goes in the same write
+// not in vdp.h yet
+// VDU 23, 0, &82: request text cursor position
+
+bool waitVDP(void){
+  sv->vpd_pflags &= ~vdp_pflag_cursor;
+  vduByte(23); vduByte(0); vduByte(0x82);
+  vduFlush();
+  clock_t timeout = clock() + CLOCKS_PER_SEC;
+  while (!(sv->vpd_pflags & vdp_pflag_cursor) && clock() < timeout);
+
+  return (sv->vpd_pflags & vdp_pflag_cursor);
+}
+
+// -----------------------------------------------------------------------
+// wait for the next vsync
+// not in vdp.h yet
+// VDU 23, 0, &C3: swap screen buffers - in a single buffered mode it just
+// waits for vsync
+
+void waitFrame(void){
+  vduByte(23); vduByte(0); vduByte(0xC3);
+  waitVDP();
+}
+
+// -----------------------------------------------------------------------
+// slide animation clock - every frame of a slide is shown at a vsync, so a
+// slide always takes slideFrames frames whatever the link speed
+// slideStart before calling the slide's program, then slideFrame waits for
+// each frame's cursor position reply
+
+void slideStart(void){
+  sv->vpd_pflags &= ~vdp_pflag_cursor;
+  slideBegan = clock();
+  frameBegan = slideBegan;
+  frameMaxTicks = 0;
+  frameCount = 0;
+}
+
+void slideFrame(void){
+  clock_t timeout = clock() + CLOCKS_PER_SEC;
+  while (!(sv->vpd_pflags & vdp_pflag_cursor) && clock() < timeout);
+  sv->vpd_pflags &= ~vdp_pflag_cursor;
+
+  clock_t now = clock();
+  if (now - frameBegan > frameMaxTicks) frameMaxTicks = now - frameBegan;
+  frameBegan = now;
+  frameCount++;
+  slideTicks = now - slideBegan;
+}
+
+// -----------------------------------------------------------------------
+// make an audio sample from a buffer
+// not in vdp.h yet
+// VDU 23, 0, &85, channel, 5, 2, bufferId; format
+
+void makeSample(uint16_t bufferID){
+  vduByte(23); vduByte(0); vduByte(0x85);
+  vduByte(0);       // channel, not used
+  vduByte(5);       // sample commands
+  vduByte(2);       // 2 = sample from buffer
+  vduWord(bufferID);
+  vduByte(0);       // format 0 = 8 bit signed
+  vduFlush();
+}
+
 // -----------------------------------------------------------------------
 // plot bitmaps at current positions in array
 
 void redrawBitmaps(void){
+  for (uint16_t xx = 0; xx < hCells ; xx++){
+    for (uint16_t yy = 0; yy < vCells ; yy++){
+      arrayShown[xx][yy] = noCell;                          // draw them all
+    }
+  }
+  redrawChanged();
+}
+
+// -----------------------------------------------------------------------
+// plot only the cells whose bitmap is not already on screen, in one write
+// in game_mode they are flipped into view and drawn again in the other buffer
+
+void redrawChanged(void){
 uint16_t thisBitmap = 0;
+uint16_t changed = 0;                   // a bit for each cell plotted
 
   for (uint16_t xx = 0; xx < hCells ; xx++){
     for (uint16_t yy = 0; yy < vCells ; yy++){
       thisBitmap = arrayBitmaps[xx][yy];
-      vdp_adv_select_bitmap(thisBitmap + startBitmapID);
-      vdp_plot_bitmap( xx * chunkSizeW, yy * chunkSizeH);          // plot the bitmap at 0,0
+      if (arrayShown[xx][yy] == thisBitmap) continue;
+      vduSelect(thisBitmap + tileBaseID);
+      vduPlot( xx * chunkSizeW, yy * chunkSizeH);          // plot the bitmap at 0,0
+      arrayShown[xx][yy] = thisBitmap;
+      changed |= 1 << (yy * hCells + xx);
     }
   }
+  if (!(currentMode & 128) || changed == 0) {
+    vduFlush();
+    return;
+  }
+
+  waitFrame();                          // sends the plots with the flip
+  for (uint16_t xx = 0; xx < hCells ; xx++){
+    for (uint16_t yy = 0; yy < vCells ; yy++){
+      if (!(changed & (1 << (yy * hCells + xx)))) continue;
+      vduSelect(arrayBitmaps[xx][yy] + tileBaseID);
+      vduPlot( xx * chunkSizeW, yy * chunkSizeH);
+    }
+  }
+  vduFlush();
+}
+
+// -----------------------------------------------------------------------
+// the last frame of a slide plotted every tile of the row (across) or
+// column exactly a cell on, which is where arrayBitmaps now has them
+
+void lineShown(bool across, uint8_t line){
+  for (uint8_t nn = 0; nn < 4; nn++){
+    if (across) arrayShown[nn][line] = arrayBitmaps[nn][line];
+    else arrayShown[line][nn] = arrayBitmaps[line][nn];
+  }
 }
 
 // -----------------------------------------------------------------------
@@ -1088,6 +2832,9 @@ void setupUDG(void){
 
 void doExit(void){
   //vdp_clear_screen();
+  if (currentMode != screen_mode) vdp_mode(screen_mode);   // MOS can't use a double buffered mode
+  if (packPointer != NULL) fclose(packPointer);
+  if (packDirect) ffs_fclose(&packFile.fil);
   vdp_cursor_enable(true);
   exit(0);
 }
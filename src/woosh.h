@@ -1,127 +0,0 @@
-// array size is 1971
-uint8_t woosh[]  = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0x00, 
-  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x02, 0x01, 0x00, 0xff, 0xfe, 0xfc, 0xfc, 
-  0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0x00, 0x01, 0x03, 0x06, 0x07, 0x06, 0x03, 
-  0x01, 0xfe, 0xfc, 0xf9, 0xf6, 0xf5, 0xf4, 0xf6, 0xf7, 0xf8, 0xfa, 0xfb, 0xfd, 0xfe, 0x00, 0x04, 
-  0x08, 0x0b, 0x0c, 0x0d, 0x0f, 0x0e, 0x09, 0x02, 0xfc, 0xf8, 0xf6, 0xf3, 0xf1, 0xee, 0xed, 0xef, 
-  0xf4, 0xf5, 0xf8, 0xfe, 0x03, 0x05, 0x09, 0x0f, 0x12, 0x13, 0x12, 0x0f, 0x0a, 0x06, 0x01, 0xfd, 
-  0xfa, 0xf6, 0xf4, 0xf4, 0xf3, 0xf1, 0xf0, 0xf1, 0xf2, 0xf6, 0xfa, 0xfd, 0xff, 0x00, 0x05, 0x0c, 
-  0x10, 0x0f, 0x0c, 0x08, 0x03, 0x01, 0xfe, 0xfb, 0xf9, 0xf7, 0xf6, 0xf4, 0xf4, 0xf7, 0xfb, 0xfd, 
-  0xfd, 0xfe, 0x00, 0x03, 0x05, 0x05, 0x04, 0x03, 0x02, 0x01, 0x01, 0x04, 0x07, 0x07, 0x06, 0x03, 
-  0xfe, 0xfa, 0xf9, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf9, 0xfc, 0xfc, 0xfd, 0x00, 0x02, 0x03, 0x04, 
-  0x06, 0x0b, 0x10, 0x10, 0x0c, 0x0a, 0x07, 0x00, 0xfa, 0xf5, 0xf1, 0xed, 0xe9, 0xe9, 0xee, 0xf2, 
-  0xf5, 0xfa, 0xff, 0x04, 0x0a, 0x10, 0x11, 0x11, 0x0f, 0x0b, 0x05, 0x00, 0xfc, 0xf9, 0xf6, 0xf3, 
-  0xf2, 0xf3, 0xf1, 0xef, 0xf1, 0xf2, 0xf2, 0xf3, 0xf7, 0xfb, 0x00, 0x06, 0x0c, 0x10, 0x10, 0x13, 
-  0x19, 0x19, 0x11, 0x0d, 0x0b, 0x00, 0xf2, 0xe8, 0xdf, 0xd6, 0xd3, 0xd6, 0xdb, 0xe7, 0xfc, 0x11, 
-  0x24, 0x33, 0x39, 0x31, 0x27, 0x23, 0x1b, 0x05, 0xe7, 0xd2, 0xc9, 0xc6, 0xc4, 0xc9, 0xdb, 0xf8, 
-  0x11, 0x22, 0x2c, 0x32, 0x34, 0x2c, 0x17, 0x00, 0xf0, 0xe4, 0xd7, 0xcc, 0xc5, 0xc9, 0xdc, 0xf5, 
-  0x09, 0x17, 0x24, 0x31, 0x37, 0x30, 0x1e, 0x0a, 0xfb, 0xf0, 0xed, 0xee, 0xec, 0xe5, 0xde, 0xde, 
-  0xe8, 0xf4, 0xfd, 0x08, 0x13, 0x1b, 0x21, 0x25, 0x21, 0x19, 0x16, 0x17, 0x15, 0x0c, 0xf9, 0xe3, 
-  0xd7, 0xd6, 0xd7, 0xd6, 0xd4, 0xd4, 0xde, 0xf5, 0x07, 0x06, 0x08, 0x15, 0x17, 0x07, 0xf9, 0xf9, 
-  0x04, 0x13, 0x18, 0x0f, 0x05, 0x05, 0x06, 0x02, 0x02, 0x03, 0x01, 0xf6, 0xe5, 0xdc, 0xe2, 0xeb, 
-  0xf3, 0x03, 0x15, 0x21, 0x2a, 0x2d, 0x21, 0x0b, 0xf5, 0xe4, 0xdd, 0xdf, 0xe3, 0xea, 0xf6, 0x06, 
-  0x10, 0x0e, 0x06, 0x07, 0x0d, 0x09, 0xf8, 0xe4, 0xd7, 0xdd, 0xf0, 0xfc, 0xff, 0x09, 0x19, 0x26, 
-  0x2f, 0x29, 0x0e, 0xf5, 0xeb, 0xe6, 0xe5, 0xe5, 0xdf, 0xdc, 0xed, 0x09, 0x24, 0x32, 0x2b, 0x20, 
-  0x21, 0x1e, 0x03, 0xe9, 0xe5, 0xde, 0xc3, 0xb0, 0xc6, 0xec, 0xf5, 0xf4, 0x0f, 0x31, 0x37, 0x2a, 
-  0x18, 0xff, 0xee, 0xec, 0xe6, 0xdd, 0xe6, 0xf3, 0xfb, 0x07, 0x14, 0x1c, 0x1f, 0x15, 0xff, 0xfd, 
-  0x0f, 0x0c, 0xeb, 0xd1, 0xd7, 0xf0, 0x06, 0x12, 0x1a, 0x1c, 0x14, 0x0d, 0x03, 0xef, 0xe2, 0xf2, 
-  0x0a, 0x18, 0x1d, 0x1a, 0x10, 0x08, 0xfc, 0xe8, 0xdb, 0xdb, 0xdf, 0xe1, 0xe5, 0xf0, 0x09, 0x22, 
-  0x27, 0x1f, 0x18, 0x0a, 0xef, 0xd6, 0xd2, 0xde, 0xe5, 0xdb, 0xcd, 0xcf, 0xe0, 0xfd, 0x23, 0x39, 
-  0x2e, 0x1a, 0x1a, 0x20, 0x16, 0x03, 0xf9, 0xf2, 0xe3, 0xdc, 0xeb, 0x05, 0x1f, 0x35, 0x35, 0x1a, 
-  0x0b, 0x14, 0x13, 0xfd, 0xe9, 0xd8, 0xc6, 0xc4, 0xd4, 0xe9, 0xff, 0x0f, 0x11, 0x12, 0x1a, 0x22, 
-  0x26, 0x21, 0x0f, 0xfe, 0xf8, 0xf5, 0xf9, 0x02, 0xfc, 0xe7, 0xd7, 0xd2, 0xd5, 0xeb, 0x0f, 0x35, 
-  0x44, 0x26, 0xf1, 0xde, 0xe9, 0xe3, 0xcd, 0xbf, 0xbe, 0xd8, 0x12, 0x44, 0x4d, 0x3d, 0x24, 0xff, 
-  0xd8, 0xc1, 0xc1, 0xd0, 0xe3, 0xf8, 0x15, 0x33, 0x44, 0x4f, 0x5f, 0x5a, 0x34, 0x04, 0xe1, 0xc9, 
-  0xbf, 0xc9, 0xd3, 0xd7, 0xe7, 0xff, 0x04, 0xfc, 0xff, 0x14, 0x31, 0x3b, 0x20, 0xfe, 0xf1, 0xeb, 
-  0xde, 0xdb, 0xe0, 0xda, 0xd2, 0xde, 0xfc, 0x1e, 0x3a, 0x44, 0x39, 0x2a, 0x23, 0x1a, 0x00, 0xe5, 
-  0xd2, 0xc3, 0xc6, 0xed, 0x1d, 0x31, 0x32, 0x2b, 0x0d, 0xe9, 0xd3, 0xc5, 0xbe, 0xc4, 0xc8, 0xcd, 
-  0xeb, 0x1a, 0x44, 0x60, 0x5f, 0x46, 0x2f, 0x17, 0xf5, 0xd7, 0xb7, 0x97, 0x9f, 0xc8, 0xdf, 0xf4, 
-  0x1f, 0x36, 0x36, 0x50, 0x64, 0x3b, 0xf3, 0xb8, 0x96, 0x94, 0xa7, 0xb4, 0xc5, 0xf1, 0x22, 0x41, 
-  0x54, 0x5e, 0x57, 0x37, 0x05, 0xdc, 0xce, 0xd1, 0xd6, 0xd6, 0xda, 0xfa, 0x30, 0x58, 0x63, 0x5c, 
-  0x44, 0x22, 0x03, 0xdf, 0xc8, 0xda, 0xf6, 0xfc, 0x02, 0x09, 0xf2, 0xd5, 0xd9, 0xec, 0xf5, 0xf7, 
-  0xfa, 0x05, 0x1d, 0x2e, 0x27, 0x0f, 0xfa, 0xf1, 0xed, 0xe2, 0xd6, 0xd5, 0xdf, 0xef, 0x00, 0x0c, 
-  0x1f, 0x39, 0x3e, 0x24, 0x01, 0xdc, 0xb3, 0x9f, 0xae, 0xd2, 0xf8, 0x14, 0x22, 0x2d, 0x39, 0x33, 
-  0x08, 0xce, 0xaf, 0xb3, 0xc1, 0xce, 0xe5, 0x09, 0x31, 0x4e, 0x55, 0x45, 0x25, 0xf8, 0xcd, 0xba, 
-  0xb2, 0xa3, 0xa2, 0xbe, 0xea, 0x1d, 0x52, 0x72, 0x71, 0x5c, 0x35, 0xfc, 0xbf, 0x97, 0x89, 0x8b, 
-  0x98, 0xb8, 0xe4, 0x04, 0x1c, 0x3a, 0x56, 0x5d, 0x49, 0x26, 0x03, 0xe5, 0xcb, 0xb9, 0xb3, 0xba, 
-  0xce, 0xf0, 0x15, 0x34, 0x4b, 0x54, 0x4c, 0x3e, 0x2c, 0x0e, 0xe4, 0xbb, 0xa0, 0x98, 0xa8, 0xd0, 
-  0xfa, 0x0d, 0x15, 0x27, 0x3a, 0x38, 0x2b, 0x1b, 0x01, 0xeb, 0xe1, 0xd5, 0xcb, 0xd7, 0xef, 0xfe, 
-  0x0c, 0x1c, 0x25, 0x25, 0x1f, 0x17, 0x16, 0x18, 0x10, 0x08, 0x0b, 0x02, 0xe8, 0xce, 0xbf, 0xc1, 
-  0xde, 0x0e, 0x2f, 0x2c, 0x12, 0xfb, 0xf0, 0xe9, 0xe6, 0xe8, 0xe7, 0xe8, 0xff, 0x22, 0x2f, 0x29, 
-  0x2a, 0x34, 0x36, 0x2b, 0x15, 0xf9, 0xda, 0xc6, 0xc0, 0xc4, 0xcd, 0xdc, 0xf6, 0x17, 0x34, 0x3e, 
-  0x41, 0x4b, 0x4e, 0x32, 0x05, 0xdb, 0xb5, 0x96, 0x8c, 0x9b, 0xc1, 0xf7, 0x30, 0x5c, 0x6e, 0x62, 
-  0x43, 0x1a, 0xf3, 0xdb, 0xd2, 0xc8, 0xc4, 0xd2, 0xea, 0xfd, 0x10, 0x22, 0x2c, 0x31, 0x34, 0x34, 
-  0x33, 0x28, 0x10, 0xfb, 0xee, 0xe0, 0xcb, 0xbb, 0xb5, 0xc0, 0xe3, 0x13, 0x3c, 0x53, 0x53, 0x45, 
-  0x39, 0x32, 0x1d, 0xf1, 0xbe, 0x9b, 0x8f, 0x9b, 0xc6, 0xfd, 0x22, 0x31, 0x42, 0x57, 0x63, 0x5a, 
-  0x33, 0xf4, 0xc0, 0xa9, 0xaa, 0xbc, 0xd5, 0xe6, 0xf3, 0x0c, 0x2c, 0x43, 0x4c, 0x3f, 0x16, 0xe5, 
-  0xca, 0xc6, 0xcc, 0xd4, 0xde, 0xe5, 0xec, 0xfa, 0x0c, 0x1b, 0x27, 0x30, 0x2f, 0x25, 0x20, 0x1e, 
-  0x14, 0x03, 0xee, 0xdc, 0xdd, 0xed, 0xfa, 0xfe, 0xfe, 0xfb, 0xfb, 0x08, 0x18, 0x18, 0x06, 0xf4, 
-  0xf1, 0xf9, 0xff, 0x01, 0x01, 0xf7, 0xe6, 0xdb, 0xde, 0xe9, 0xf9, 0x0a, 0x13, 0x1b, 0x2a, 0x34, 
-  0x2d, 0x16, 0xfa, 0xe3, 0xd5, 0xd0, 0xd1, 0xde, 0xf3, 0x06, 0x12, 0x18, 0x18, 0x15, 0x11, 0x06, 
-  0xfa, 0xf8, 0xfa, 0xef, 0xdf, 0xdd, 0xeb, 0xfd, 0x08, 0x03, 0xf8, 0xf6, 0xf6, 0xf4, 0xfc, 0x16, 
-  0x27, 0x1e, 0x0b, 0x00, 0xff, 0xfa, 0xec, 0xdf, 0xe1, 0xf2, 0x05, 0x0f, 0x0e, 0x03, 0xf6, 0xea, 
-  0xe1, 0xe0, 0xec, 0xfd, 0x0b, 0x15, 0x1a, 0x1b, 0x16, 0x0b, 0x05, 0x02, 0xf8, 0xe2, 0xd1, 0xd1, 
-  0xdf, 0xf6, 0x0c, 0x16, 0x19, 0x1e, 0x1e, 0x16, 0x0b, 0xfb, 0xea, 0xe3, 0xe5, 0xe9, 0xf4, 0x04, 
-  0x07, 0xf4, 0xe1, 0xe4, 0xf6, 0x05, 0x08, 0x05, 0x0a, 0x16, 0x1e, 0x13, 0xf6, 0xdb, 0xd3, 0xdf, 
-  0xec, 0xeb, 0xde, 0xd8, 0xea, 0x0d, 0x2c, 0x37, 0x2b, 0x12, 0xfd, 0xf1, 0xe9, 0xe2, 0xdd, 0xd9, 
-  0xda, 0xe5, 0x00, 0x1f, 0x32, 0x34, 0x2a, 0x14, 0xfc, 0xea, 0xdd, 0xd7, 0xe4, 0xf1, 0xf0, 0xfb, 
-  0x17, 0x22, 0x17, 0x11, 0x0d, 0x00, 0xec, 0xdc, 0xd9, 0xe7, 0xf1, 0xeb, 0xe9, 0xf6, 0x04, 0x09, 
-  0x08, 0x04, 0x09, 0x19, 0x24, 0x21, 0x19, 0x0d, 0xfa, 0xe5, 0xd9, 0xd7, 0xdb, 0xe3, 0xed, 0xf8, 
-  0x04, 0x14, 0x23, 0x23, 0x1a, 0x13, 0x0c, 0xfb, 0xe8, 0xd8, 0xca, 0xc6, 0xd9, 0xfb, 0x1c, 0x2c, 
-  0x2a, 0x22, 0x1f, 0x1c, 0x0f, 0xf9, 0xe5, 0xdc, 0xdc, 0xe3, 0xec, 0xf2, 0xfa, 0x0a, 0x1c, 0x23, 
-  0x19, 0x03, 0xec, 0xe4, 0xe7, 0xe9, 0xe9, 0xef, 0xf9, 0x09, 0x1d, 0x2b, 0x2a, 0x21, 0x15, 0x04, 
-  0xf1, 0xdf, 0xcc, 0xbe, 0xc3, 0xdb, 0xf3, 0xff, 0x05, 0x11, 0x1f, 0x2d, 0x37, 0x36, 0x27, 0x15, 
-  0x05, 0xf1, 0xd9, 0xcc, 0xcf, 0xd8, 0xdd, 0xe0, 0xe8, 0xef, 0xef, 0xf1, 0xff, 0x14, 0x23, 0x2b, 
-  0x2d, 0x2b, 0x25, 0x1b, 0x0c, 0xfa, 0xe9, 0xe5, 0xea, 0xe8, 0xe3, 0xe9, 0xf3, 0xf7, 0xfb, 0x00, 
-  0x05, 0x0e, 0x17, 0x19, 0x18, 0x16, 0x12, 0x0d, 0x05, 0xf6, 0xea, 0xe5, 0xdd, 0xda, 0xe5, 0xf4, 
-  0x00, 0x0a, 0x11, 0x16, 0x1a, 0x16, 0x0d, 0x0a, 0x09, 0x04, 0x00, 0xfa, 0xf3, 0xee, 0xef, 0xf7, 
-  0x07, 0x17, 0x18, 0x0d, 0xfa, 0xe6, 0xde, 0xe2, 0xe9, 0xee, 0xf2, 0x02, 0x1b, 0x2b, 0x2b, 0x29, 
-  0x25, 0x12, 0xfa, 0xea, 0xd9, 0xce, 0xd1, 0xde, 0xef, 0x00, 0x0a, 0x0c, 0x11, 0x17, 0x18, 0x15, 
-  0x14, 0x12, 0x0f, 0x09, 0xfc, 0xed, 0xe5, 0xe8, 0xee, 0xf2, 0xfc, 0x08, 0x09, 0x06, 0x09, 0x0a, 
-  0x03, 0xfd, 0xf9, 0xf7, 0xfa, 0xfb, 0xf9, 0xff, 0x08, 0x07, 0x06, 0x0c, 0x12, 0x14, 0x0f, 0x02, 
-  0xf3, 0xef, 0xec, 0xeb, 0xf1, 0xf8, 0xfc, 0x05, 0x12, 0x19, 0x1c, 0x1a, 0x10, 0xfc, 0xe7, 0xda, 
-  0xdd, 0xec, 0xf9, 0xff, 0x01, 0x07, 0x13, 0x1a, 0x18, 0x16, 0x16, 0x14, 0x0c, 0xfd, 0xee, 0xe6, 
-  0xe2, 0xdf, 0xe3, 0xee, 0xf9, 0x05, 0x0e, 0x14, 0x1d, 0x20, 0x13, 0x00, 0xfa, 0xfc, 0xfa, 0xf6, 
-  0xf0, 0xef, 0xf7, 0xfe, 0xfe, 0xfc, 0x01, 0x0e, 0x1a, 0x1a, 0x12, 0x12, 0x13, 0x0a, 0xfc, 0xec, 
-  0xdc, 0xd7, 0xdf, 0xec, 0xf9, 0x05, 0x0c, 0x0d, 0x0f, 0x12, 0x0b, 0x00, 0xfa, 0xf9, 0xf8, 0xfb, 
-  0x02, 0x02, 0x00, 0x06, 0x0d, 0x0b, 0x03, 0xfd, 0xf9, 0xfa, 0xfc, 0xfe, 0x02, 0x02, 0xfb, 0xf9, 
-  0x00, 0x06, 0x05, 0x01, 0xfb, 0xf3, 0xeb, 0xe6, 0xe7, 0xed, 0xf1, 0xf5, 0xff, 0x09, 0x0a, 0x0f, 
-  0x1c, 0x29, 0x29, 0x1f, 0x0e, 0xfb, 0xea, 0xde, 0xda, 0xdf, 0xe9, 0xee, 0xef, 0xf6, 0x05, 0x12, 
-  0x17, 0x15, 0x0a, 0x01, 0x00, 0xfe, 0xf4, 0xe9, 0xea, 0xf3, 0xfd, 0x01, 0xfc, 0xf9, 0xff, 0x08, 
-  0x0b, 0x0a, 0x07, 0x01, 0xfc, 0xfb, 0xfc, 0xfe, 0x02, 0x06, 0x07, 0x05, 0x04, 0xff, 0xf7, 0xf1, 
-  0xf0, 0xf1, 0xef, 0xef, 0xf3, 0xf8, 0xfe, 0x06, 0x0b, 0x0b, 0x0e, 0x12, 0x13, 0x0e, 0x04, 0xf7, 
-  0xeb, 0xe9, 0xef, 0xf5, 0xf8, 0xfa, 0xfb, 0xfd, 0x02, 0x06, 0x04, 0x00, 0xff, 0x00, 0xff, 0xfe, 
-  0xfe, 0x01, 0x04, 0x06, 0x05, 0x05, 0x06, 0x02, 0xfd, 0xfa, 0xf7, 0xf5, 0xf3, 0xf1, 0xeb, 0xe9, 
-  0xee, 0xf4, 0xf5, 0xf8, 0xff, 0x07, 0x0c, 0x0c, 0x0c, 0x10, 0x13, 0x0e, 0x04, 0xfa, 0xf6, 0xf8, 
-  0xfb, 0xfb, 0xfa, 0xfa, 0xfc, 0xff, 0x01, 0xff, 0xfc, 0xfa, 0xf6, 0xf2, 0xf1, 0xf3, 0xf6, 0xfa, 
-  0x03, 0x07, 0x05, 0x03, 0x06, 0x0b, 0x0b, 0x07, 0x01, 0xfa, 0xf6, 0xf2, 0xf0, 0xf1, 0xf2, 0xf3, 
-  0xf5, 0xfb, 0x01, 0x08, 0x0c, 0x0c, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0xfd, 0xfb, 0xfc, 0xfc, 
-  0xf9, 0xf6, 0xf8, 0xfe, 0x02, 0x00, 0xfb, 0xf7, 0xf6, 0xf7, 0xf9, 0xfc, 0xfe, 0x02, 0x05, 0x07, 
-  0x08, 0x07, 0x05, 0x06, 0x07, 0x04, 0xfc, 0xf6, 0xf4, 0xf6, 0xfa, 0xfd, 0xfe, 0xfd, 0xfe, 0xfe, 
-  0xfd, 0xfe, 0xfe, 0xfd, 0xfd, 0x00, 0x02, 0x03, 0x03, 0x02, 0x00, 0x00, 0x00, 0xfd, 0xf9, 0xf8, 
-  0xf8, 0xf8, 0xf8, 0xf7, 0xf9, 0xff, 0x04, 0x06, 0x09, 0x0a, 0x07, 0x03, 0x00, 0xfd, 0xfb, 0xfa, 
-  0xf9, 0xf8, 0xfa, 0xfd, 0xfe, 0xfe, 0xff, 0x04, 0x0a, 0x0a, 0x05, 0xfc, 0xf4, 0xf1, 0xf3, 0xf9, 
-  0xfe, 0x00, 0xfe, 0xfe, 0x01, 0x03, 0x02, 0xff, 0xfb, 0xf8, 0xf8, 0xfa, 0xfd, 0xfe, 0xfd, 0xff, 
-  0x03, 0x06, 0x05, 0x04, 0x02, 0xff, 0xfd, 0xfa, 0xf5, 0xf4, 0xf6, 0xf9, 0xfb, 0xfe, 0x01, 0x03, 
-  0x04, 0x03, 0x01, 0x01, 0x01, 0xff, 0xfb, 0xf8, 0xf8, 0xf9, 0xfb, 0xfc, 0xfe, 0xfe, 0xfd, 0xfe, 
-  0xff, 0x01, 0x03, 0x05, 0x05, 0x03, 0x01, 0xfd, 0xfc, 0xff, 0x01, 0xff, 0xfc, 0xfb, 0xf9, 0xf8, 
-  0xfa, 0xfc, 0xfc, 0xfb, 0xfc, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x01, 0xff, 0xff, 
-  0x01, 0x01, 0xff, 0xff, 0xff, 0xfd, 0xfa, 0xf9, 0xfa, 0xfc, 0xfb, 0xf9, 0xfa, 0xfc, 0xff, 0x02, 
-  0x04, 0x06, 0x05, 0x04, 0x01, 0xff, 0xfe, 0xfd, 0xfe, 0xfd, 0xfc, 0xfc, 0xfd, 0xff, 0x00, 0xff, 
-  0xfe, 0xfd, 0xfc, 0xfc, 0xfd, 0xfe, 0xff, 0x00, 0xff, 0x01, 0x05, 0x08, 0x05, 0xff, 0xfc, 0xfc, 
-  0xfc, 0xfb, 0xfa, 0xfa, 0xfb, 0xfd, 0xff, 0x01, 0x02, 0x01, 0x00, 0xff, 0xfd, 0xfc, 0xfc, 0xfb, 
-  0xfa, 0xfb, 0xfe, 0xfe, 0xfd, 0xff, 0x03, 0x06, 0x08, 0x09, 0x09, 0x07, 0x03, 0xff, 0xfc, 0xf9, 
-  0xf8, 0xf9, 0xfa, 0xfa, 0xfb, 0xfc, 0xfd, 0xff, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 
-  0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0xff, 0xfe, 0xfd, 0xfd, 0xfe, 0xfd, 0xfc, 0xfd, 0xfe, 0xfe, 
-  0xff, 0x02, 0x04, 0x03, 0x02, 0x01, 0x00, 0xfe, 0xfd, 0xfc, 0xfd, 0xff, 0x00, 0x01, 0x02, 0x01, 
-  0xff, 0x00, 0x02, 0x03, 0x02, 0x01, 0xff, 0xfd, 0xfb, 0xfc, 0xfd, 0xfe, 0xfe, 0xff, 0x01, 0x02, 
-  0x01, 0x01, 0x02, 0x01, 0x00, 0xfe, 0xfe, 0xff, 0x01, 0x02, 0x03, 0x03, 0x01, 0xfe, 0xfd, 0xfe, 
-  0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x02, 0x01, 0x01, 0x02, 
-  0x02, 0x00, 0x00, 0x00, 0xfe, 0xfd, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0x00, 0x03, 0x03, 0x01, 
-  0x01, 0x02, 0x01, 0x01, 0x02, 0x00, 0xfd, 0xfd, 0xfe, 0x00, 0x02, 0xff, 0xfd, 0xff, 0x01, 0xfe, 
-  0xfc, 0xfc, 0xfb, 0xfc, 0xfe, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0xff, 0x00, 0xff, 0xfe, 0xfe, 
-  0xff, 0x00, 0x00, 0xff, 0xfe, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xfd, 
-  0xfe, 0xff, 0x00
-};
\ No newline at end of file
@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+"""
+Build /puzzles/slider.dat, the sounds and label sprites slider loads at
+startup, from the files in assets/. Keeping them out of slider.bin makes the
+binary smaller, and each asset carries a hash of its contents so slider can
+skip uploading anything the VDP still has from the last run.
+
+slider.dat layout (numbers LSB first):
+  4 bytes   "SDAT"
+  1 byte    version (2)
+  1 byte    number of assets
+  2 bytes   spare
+  then for each asset, 20 bytes:
+  1 byte    kind: 0 = audio sample, 1 = RGBA8888 bitmap, 2 = bitmap atlas,
+            3 = ADPCM audio sample
+  1 byte    id: sample number (1 is sample -1) or (first) bitmap number
+  1 byte    width  } bitmaps only
+  1 byte    height }
+  1 byte    number of bitmaps in an atlas
+  1 byte    flags: 1 = lazy, only loaded when slider first needs it
+  2 bytes   spare
+  4 bytes   FNV-1a hash of the data
+  4 bytes   offset of the data from start of file
+  4 bytes   size of the data
+  then the data of each asset
+
+An atlas is its bitmaps converted to RGBA2222 and put one above the other,
+then VDP compressed (see rgb2z.py). slider sends it in one go and the VDP
+expands it and splits it into the separate bitmaps. The label sprites only
+use 2 bit colour levels and on/off transparency, so they look exactly the
+same as the RGBA8888 originals for an eighth of the bytes, or less after
+compression.
+
+Samples are 8 bit signed, stored as 4 bit IMA ADPCM: a 4 byte sample count
+then 2 samples a byte, low nibble first. slider expands them on the eZ80 as
+they are sent, so they take half the space in the file.
+
+usage:
+  mkassets.py                          write puzzles/slider.dat from assets/
+  mkassets.py -o other.dat
+"""
+
+import os
+import struct
+import sys
+
+import rgb2z
+
+SAMPLE = 0
+BITMAP = 1
+ATLAS = 2
+SAMPLE_ADPCM = 3
+
+LAZY = 1
+
+LABELS = ["label1.rgba", "label2.rgba", "label3.rgba", "label4.rgba",
+          "labelA.rgba", "labelB.rgba", "labelC.rgba", "labelD.rgba"]
+
+# kind, id, width, height, flags, files - in upload order
+ASSETS = [
+    (SAMPLE_ADPCM, 1, 0, 0, 0, ["woosh.raw"]),
+    (SAMPLE_ADPCM, 2, 0, 0, LAZY, ["completed.raw"]),       # only needed once a puzzle is solved
+    (ATLAS, 0, 16, 16, 0, LABELS),
+]
+
+STEPS = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767]
+INDEX = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+ENTRY_SIZE = 20
+
+
+def fnv1a(data):
+    h = 0x811C9DC5
+    for v in data:
+        h = ((h ^ v) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def adpcm_step(code, predictor, index):
+    """One decoder step, exactly as slider's sendADPCM() does it."""
+    step = STEPS[index]
+    diff = step >> 3
+    if code & 4:
+        diff += step
+    if code & 2:
+        diff += step >> 1
+    if code & 1:
+        diff += step >> 2
+    predictor += -diff if code & 8 else diff
+    predictor = max(-32768, min(32767, predictor))
+    index = max(0, min(88, index + INDEX[code & 7]))
+    return predictor, index
+
+
+def adpcm(data):
+    """8 bit signed samples to 4 bit IMA ADPCM. Returns the data and the
+    decoded samples, to check how close they are."""
+    predictor = 0
+    index = 0
+    codes = []
+    decoded = bytearray()
+    for v in data:
+        # aim for the middle of the 256 values that decode (>> 8) to v
+        target = (((v ^ 0x80) - 0x80) << 8) + 128
+        best = None
+        for code in range(16):
+            p, i = adpcm_step(code, predictor, index)
+            if best is None or abs(target - p) < abs(target - best[1]):
+                best = (code, p, i)
+        code, predictor, index = best
+        codes.append(code)
+        decoded.append((predictor >> 8) & 0xFF)
+    if len(codes) & 1:
+        codes.append(0)
+    out = struct.pack("<I", len(data)) + bytes(codes[n] | (codes[n + 1] << 4) for n in range(0, len(codes), 2))
+    return out, bytes(decoded)
+
+
+def rgba2222(data):
+    """RGBA8888 to RGBA2222, keeping the top 2 bits of each - as the VDP does."""
+    return bytes(((data[n + 3] >> 6) << 6) | ((data[n + 2] >> 6) << 4) | ((data[n + 1] >> 6) << 2) | (data[n] >> 6)
+                 for n in range(0, len(data), 4))
+
+
+def load(kind, folder, names):
+    data = []
+    for name in names:
+        with open(os.path.join(folder, name), "rb") as fp:
+            data.append(fp.read())
+    if kind == ATLAS:
+        return rgb2z.compress(b"".join(rgba2222(d) for d in data)), sum(len(d) for d in data)
+    if kind == SAMPLE_ADPCM:
+        packed, decoded = adpcm(data[0])
+        error = max(abs(((a ^ 0x80) - 0x80) - ((b ^ 0x80) - 0x80)) for a, b in zip(data[0], decoded))
+        print("%-24s largest ADPCM error %d" % (names[0], error))
+        return packed, len(data[0])
+    return data[0], len(data[0])
+
+
+def main(args):
+    here = os.path.dirname(os.path.abspath(__file__))
+    folder = os.path.join(here, "..", "assets")
+    out_name = os.path.join(here, "..", "puzzles", "slider.dat")
+    while args:
+        a = args.pop(0)
+        if a == "-o":
+            out_name = args.pop(0)
+        else:
+            print(__doc__)
+            return 1
+
+    blobs = []
+    offset = 8 + ENTRY_SIZE * len(ASSETS)
+    index = bytearray(b"SDAT" + bytes([2, len(ASSETS), 0, 0]))
+    for kind, ident, w, h, flags, names in ASSETS:
+        data, original = load(kind, folder, names)
+        index += struct.pack("<BBBBBB2xIII", kind, ident, w, h, len(names), flags, fnv1a(data), offset, len(data))
+        offset += len(data)
+        blobs.append(data)
+        print("%-24s %6d -> %6d bytes" % (", ".join(names) if len(names) < 3 else "%d bitmaps" % len(names), original, len(data)))
+
+    with open(out_name, "wb") as fp:
+        fp.write(index + b"".join(blobs))
+    print("%s: %d assets, %d bytes" % (os.path.normpath(out_name), len(ASSETS), offset))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
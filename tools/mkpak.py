@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""
+Build /puzzles/slider.pak from a folder of slider pictures (.RGB2, .RGB2Z
+or .RGB2P). With a pack present slider reads the index once at startup and
+seeks within one open file, instead of scanning the directory and opening
+every picture. Picker icons are stored ready made.
+
+slider.pak layout (numbers LSB first):
+  4 bytes   "SPAK"
+  1 byte    version (2)
+  2 bytes   number of pictures
+  1 byte    spare
+  then for each picture, 44 bytes:
+  32 bytes  file name, zero padded - the extension gives the format
+  4 bytes   offset of picture data from start of pack
+  4 bytes   size of picture data
+  4 bytes   offset of 80x60 RGBA2222 icon
+  then all the icons, then all the picture data, each copied unchanged
+
+usage:
+  mkpak.py puzzles/                    write puzzles/slider.pak
+  mkpak.py puzzles/ -o other.pak
+"""
+
+import os
+import struct
+import sys
+
+import rgb2z
+
+MAX_PICTURES = 512      # slider's MAX_PUZZLES
+ENTRY_SIZE = 44
+ICON_SIZE = 80 * 60
+FORMATS = (".RGB2", ".RGB2Z", ".RGB2P")
+
+
+def expand_palette(data):
+    """Turn .RGB2P back into raw RGBA2222, the same way slider does."""
+    bpp = data[5]
+    entries = data[6]
+    palette = data[8:8 + entries]
+    packed = data[8 + entries:]
+    out = bytearray()
+    if bpp == 4:
+        for v in packed:
+            out += bytes([palette[v >> 4], palette[v & 15]])
+    else:
+        for n in range(0, len(packed), 3):
+            bits = (packed[n] << 16) | (packed[n + 1] << 8) | packed[n + 2]
+            out += bytes(palette[(bits >> s) & 63] for s in (18, 12, 6, 0))
+    return bytes(out)
+
+
+def make_icon(name, data):
+    ext = os.path.splitext(name)[1].upper()
+    if ext == ".RGB2Z":
+        return data[8:8 + ICON_SIZE]
+    if ext == ".RGB2P":
+        data = expand_palette(data)
+    return rgb2z.icon(data)
+
+
+def main(args):
+    out_name = None
+    folder = None
+    while args:
+        a = args.pop(0)
+        if a == "-o":
+            out_name = args.pop(0)
+        else:
+            folder = a
+    if folder is None:
+        print(__doc__)
+        return 1
+    if out_name is None:
+        out_name = os.path.join(folder, "slider.pak")
+
+    names = sorted(f for f in os.listdir(folder)
+                   if not f.startswith(".") and os.path.splitext(f)[1].upper() in FORMATS)
+    if len(names) > MAX_PICTURES:
+        print("only the first %d of %d pictures will fit" % (MAX_PICTURES, len(names)))
+        names = names[:MAX_PICTURES]
+    if not names:
+        print("no pictures found in %s" % folder)
+        return 1
+
+    pictures = []
+    for n in names:
+        if len(n.encode()) > 31:
+            raise ValueError("file name too long: %s" % n)
+        with open(os.path.join(folder, n), "rb") as fp:
+            pictures.append(fp.read())
+
+    icon_start = 8 + ENTRY_SIZE * len(names)
+    data_start = icon_start + ICON_SIZE * len(names)
+
+    index = bytearray(b"SPAK" + struct.pack("<BHB", 2, len(names), 0))
+    icons = bytearray()
+    data = bytearray()
+    for n, pic in zip(names, pictures):
+        index += n.encode().ljust(32, b"\0")
+        index += struct.pack("<III", data_start + len(data), len(pic), icon_start + len(icons))
+        icons += make_icon(n, pic)
+        data += pic
+
+    with open(out_name, "wb") as fp:
+        fp.write(index + icons + data)
+    print("%s: %d pictures, %d bytes" % (out_name, len(names), len(index) + len(icons) + len(data)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""
+Convert slider puzzle images from .RGB2 (raw 320x240 RGBA2222, 76,800 bytes)
+to .RGB2P, a palette indexed version that slider expands back to RGBA2222
+on the eZ80 as it reads it, so there is less to read from the SD card.
+
+.RGB2P layout:
+  4 bytes   "RGBP"
+  1 byte    version (1)
+  1 byte    bits per pixel (4 or 6)
+  1 byte    number of palette entries (up to 16 or 64)
+  1 byte    spare
+  n bytes   palette, one RGBA2222 byte per entry
+  then the pixels, top line first, packed MSB first:
+    4 bpp   2 pixels per byte              38,400 bytes
+    6 bpp   4 pixels per 3 bytes           57,600 bytes
+
+The picture is stored losslessly at 4 bpp if it has 16 colours or fewer,
+otherwise at 6 bpp. A picture with more than 64 colours is mapped to the
+nearest of its 64 most used colours (lossy). --colours 16 forces 4 bpp
+the same way.
+
+usage:
+  rgb2p.py [--colours 16] file.RGB2 [file.RGB2 ...]   write file.RGB2P
+  rgb2p.py --report [--colours 16] puzzles/           show sizes, don't write
+"""
+
+import os
+import sys
+from collections import Counter
+
+WIDTH = 320
+HEIGHT = 240
+IMAGE_SIZE = WIDTH * HEIGHT
+MAX_COLOURS = 64        # most a 6 bit index can pick from
+
+
+def rgba(v):
+    return ((v >> 4) & 3, (v >> 2) & 3, v & 3, (v >> 6) & 3)
+
+
+def nearest(v, palette):
+    a = rgba(v)
+    return min(range(len(palette)), key=lambda n: sum((x - y) ** 2 for x, y in zip(a, rgba(palette[n]))))
+
+
+def convert(image, colours=None):
+    if len(image) != IMAGE_SIZE:
+        raise ValueError("image is %d bytes, expected %d" % (len(image), IMAGE_SIZE))
+    counts = Counter(image)
+    if colours is None:
+        colours = MAX_COLOURS
+    if len(counts) > colours:
+        palette = [c for c, _ in counts.most_common(colours)]
+    else:
+        palette = sorted(counts)
+    bpp = 4 if len(palette) <= 16 else 6
+
+    index = {}
+    for c in counts:
+        index[c] = palette.index(c) if c in palette else nearest(c, palette)
+    pixels = [index[v] for v in image]
+
+    out = bytearray(b"RGBP" + bytes([1, bpp, len(palette), 0]) + bytes(palette))
+    if bpp == 4:
+        for n in range(0, IMAGE_SIZE, 2):
+            out.append((pixels[n] << 4) | pixels[n + 1])
+    else:
+        for n in range(0, IMAGE_SIZE, 4):
+            bits = (pixels[n] << 18) | (pixels[n + 1] << 12) | (pixels[n + 2] << 6) | pixels[n + 3]
+            out += bytes([bits >> 16, (bits >> 8) & 0xFF, bits & 0xFF])
+    lossless = all(palette[i] == v for i, v in zip(pixels, image))
+    return bytes(out), bpp, lossless
+
+
+def main(args):
+    report = False
+    colours = None
+    files = []
+    while args:
+        a = args.pop(0)
+        if a == "--report":
+            report = True
+        elif a == "--colours":
+            colours = int(args.pop(0))
+            if not 1 <= colours <= MAX_COLOURS:
+                print("--colours must be 1 to %d" % MAX_COLOURS)
+                return 1
+        elif os.path.isdir(a):
+            files += sorted(os.path.join(a, f) for f in os.listdir(a) if f.upper().endswith(".RGB2"))
+        else:
+            files.append(a)
+    if not files:
+        print(__doc__)
+        return 1
+
+    total_raw = 0
+    total_packed = 0
+    for f in files:
+        with open(f, "rb") as fp:
+            image = fp.read()
+        packed, bpp, lossless = convert(image, colours)
+        total_raw += len(image)
+        total_packed += len(packed)
+        print("%-24s %6d -> %6d bytes read (%3d%%) %d bpp%s" % (os.path.basename(f), len(image), len(packed),
+              len(packed) * 100 // len(image), bpp, "" if lossless else ", lossy"))
+        if not report:
+            with open(f + "P", "wb") as fp:
+                fp.write(packed)
+    if len(files) > 1:
+        print("%-24s %6d -> %6d bytes read (%3d%%)" % ("total", total_raw, total_packed, total_packed * 100 // total_raw))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+"""
+Convert slider puzzle images from .RGB2 (raw 320x240 RGBA2222, 76,800 bytes)
+to .RGB2Z, which is sent to the VDP compressed and expanded there with the
+buffer decompress command (VDU 23, 0, &A0, target; 65, source;).
+
+.RGB2Z layout:
+  4 bytes   "RGBZ"
+  1 byte    version (1)
+  1 byte    number of tiles (16)
+  2 bytes   spare
+  4800      80x60 RGBA2222 picker icon, uncompressed
+  then for each tile, left to right, top to bottom:
+  2 bytes   length of compressed tile (LSB first)
+  n bytes   VDP compressed 80x60 tile ("Cmp" 'T' header + data)
+
+Each tile is compressed on its own so the VDP can expand it straight into
+its tile buffer - no full size intermediate buffer is needed.
+
+usage:
+  rgb2z.py file.RGB2 [file.RGB2 ...]     write file.RGB2Z next to each file
+  rgb2z.py --report puzzles/             show bytes on the wire, don't write
+"""
+
+import os
+import struct
+import sys
+
+WIDTH = 320
+HEIGHT = 240
+TILE_W = 80
+TILE_H = 60
+TILES_ACROSS = 4
+TILES_DOWN = 4
+IMAGE_SIZE = WIDTH * HEIGHT
+
+WINDOW_SIZE = 256       # VDP compression sliding window
+STRING_SIZE = 4         # bytes replaced by one window reference
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.byte = 0
+        self.bits = 0
+
+    def bit(self, b):
+        self.byte = ((self.byte << 1) | b) & 0xFF
+        self.bits += 1
+        if self.bits == 8:
+            self.out.append(self.byte)
+            self.byte = 0
+            self.bits = 0
+
+    def byte8(self, v):
+        for n in range(7, -1, -1):
+            self.bit((v >> n) & 1)
+
+    def flush(self):
+        if self.bits:
+            self.out.append((self.byte << (8 - self.bits)) & 0xFF)
+            self.byte = 0
+            self.bits = 0
+
+
+def compress(data):
+    """VDP style compression: a 1 bit flag then either a literal byte (0)
+    or the window index of a matching 4 byte string (1)."""
+    bw = BitWriter()
+    window = bytearray(WINDOW_SIZE)
+    size = 0
+    write = 0
+
+    def push(v):
+        nonlocal size, write
+        window[write] = v
+        write = (write + 1) & (WINDOW_SIZE - 1)
+        if size < WINDOW_SIZE:
+            size += 1
+
+    i = 0
+    while i < len(data):
+        s = bytes(data[i:i + STRING_SIZE])
+        start = -1
+        if len(s) == STRING_SIZE:
+            if size < WINDOW_SIZE:
+                start = bytes(window[:size]).find(s)
+            else:
+                # never match across the bytes about to be overwritten, so the
+                # result is the same whichever order the decoder updates in
+                first = (write + STRING_SIZE) & (WINDOW_SIZE - 1)
+                rot = bytes(window[first:] + window[:first])
+                pos = rot.find(s, 0, WINDOW_SIZE - STRING_SIZE)
+                if pos >= 0:
+                    start = (first + pos) & (WINDOW_SIZE - 1)
+        if start >= 0:
+            bw.bit(1)
+            bw.byte8(start)
+            for v in s:
+                push(v)
+            i += STRING_SIZE
+        else:
+            bw.bit(0)
+            bw.byte8(data[i])
+            push(data[i])
+            i += 1
+    bw.flush()
+    return b"Cmp" + b"T" + struct.pack("<I", len(data)) + bytes(bw.out)
+
+
+def decompress(comp):
+    """Reference decoder, used to check every tile before it is written."""
+    if comp[:4] != b"CmpT":
+        raise ValueError("not VDP compressed data")
+    (orig,) = struct.unpack("<I", comp[4:8])
+    window = bytearray(WINDOW_SIZE)
+    write = 0
+    out = bytearray()
+    bitpos = 64
+    total = len(comp) * 8
+
+    def read(n):
+        nonlocal bitpos
+        v = 0
+        for _ in range(n):
+            v = (v << 1) | ((comp[bitpos >> 3] >> (7 - (bitpos & 7))) & 1)
+            bitpos += 1
+        return v
+
+    while len(out) < orig and bitpos + 9 <= total:
+        if read(1):
+            start = read(8)
+            s = [window[(start + n) & (WINDOW_SIZE - 1)] for n in range(STRING_SIZE)]
+        else:
+            s = [read(8)]
+        for v in s:
+            out.append(v)
+            window[write] = v
+            write = (write + 1) & (WINDOW_SIZE - 1)
+    return bytes(out[:orig])
+
+
+def tile(image, t):
+    """Cut tile t (row major) out of a 320x240 image."""
+    row = t // TILES_ACROSS
+    col = t % TILES_ACROSS
+    data = bytearray()
+    for y in range(TILE_H):
+        o = ((row * TILE_H) + y) * WIDTH + (col * TILE_W)
+        data += image[o:o + TILE_W]
+    return bytes(data)
+
+
+def icon(image):
+    """80x60 icon, every 4th pixel of every 4th line - same as slider does."""
+    return bytes(image[y * WIDTH + x] for y in range(0, HEIGHT, 4) for x in range(0, WIDTH, 4))
+
+
+def convert(image):
+    if len(image) != IMAGE_SIZE:
+        raise ValueError("image is %d bytes, expected %d" % (len(image), IMAGE_SIZE))
+    out = bytearray(b"RGBZ" + bytes([1, TILES_ACROSS * TILES_DOWN, 0, 0]))
+    out += icon(image)
+    for t in range(TILES_ACROSS * TILES_DOWN):
+        raw = tile(image, t)
+        comp = compress(raw)
+        if decompress(comp) != raw:
+            raise ValueError("tile %d does not survive a round trip" % t)
+        out += struct.pack("<H", len(comp)) + comp
+    return bytes(out)
+
+
+def wire_bytes(rgb2z):
+    """Bytes sent to the VDP when loading a puzzle: the compressed tiles only."""
+    return len(rgb2z) - 8 - (TILE_W * TILE_H) - 2 * TILES_ACROSS * TILES_DOWN
+
+
+def main(args):
+    report = False
+    if args and args[0] == "--report":
+        report = True
+        args = args[1:]
+    if not args:
+        print(__doc__)
+        return 1
+
+    files = []
+    for a in args:
+        if os.path.isdir(a):
+            files += sorted(os.path.join(a, f) for f in os.listdir(a) if f.upper().endswith(".RGB2"))
+        else:
+            files.append(a)
+
+    total_raw = 0
+    total_wire = 0
+    for f in files:
+        with open(f, "rb") as fp:
+            image = fp.read()
+        packed = convert(image)
+        wire = wire_bytes(packed)
+        total_raw += len(image)
+        total_wire += wire
+        print("%-24s %6d -> %6d bytes on the wire (%3d%%)" % (os.path.basename(f), len(image), wire, wire * 100 // len(image)))
+        if not report:
+            with open(f + "Z", "wb") as fp:
+                fp.write(packed)
+    if len(files) > 1:
+        print("%-24s %6d -> %6d bytes on the wire (%3d%%)" % ("total", total_raw, total_wire, total_wire * 100 // total_raw))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))